@@ -4,6 +4,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 #include "var.h"
 
@@ -12,6 +13,16 @@ namespace tsym {
 }
 
 namespace tsym {
+    /* Bound for a truncated expansion: terms are dropped if their degree in one of the symbols
+     * exceeds the corresponding entry of degrees (if given), or if their total degree in all symbols
+     * exceeds totalDegree (if given): */
+    struct DegreeBound {
+        std::vector<Var> symbols;
+        std::optional<int> totalDegree;
+        /* Either empty or one entry per symbol: */
+        std::vector<std::optional<int>> degrees;
+    };
+
     /* Central functions and constants, that they are allowed to pollute the global tsym namespace,
      * i.e., common mathematical functions and constants, the interface for parsing expressions and
      * functions for the solution of linear systems of equations and the like. */
@@ -29,14 +40,37 @@ namespace tsym {
     Var atan2(const Var& y, const Var& x);
 
     Var subst(const Var& arg, const Var& from, const Var& to);
+    /* Replaces all keys of the map by their values in one single traversal, which is much cheaper
+     * than substituting one after another. Substituted values are not processed again, i.e.,
+     * {a: b, b: c} applied to a + b gives b + c: */
+    Var subst(const Var& arg, const std::unordered_map<Var, Var>& replacements);
+    /* Numerical evaluation with the given (numerically evaluable) values for symbols. The
+     * expression tree is walked directly, i.e., nothing is substituted and simplified in between.
+     * The result is an exact fraction or integer if possible and a double otherwise. Nothing is
+     * returned if a symbol isn't bound or the evaluation fails, e.g. for a division by zero: */
+    std::optional<Var> evaluate(const Var& arg, const std::unordered_map<Var, Var>& bindings);
     Var expand(const Var& arg);
+    /* Expansion, that never creates terms above the given bound, e.g. for perturbation series. The
+     * degree of a term is the sum of the exponents of the symbols among its factors, denominators
+     * aren't truncated: */
+    Var expand(const Var& arg, const DegreeBound& bound);
     Var normal(const Var& arg);
+    /* Rewrites a polynomial with rational coefficients into a nested Horner scheme that is
+     * cheaper to evaluate, e.g. a*b*x^2 + a*x + 1 becomes 1 + a*x*(1 + b*x). Multivariate
+     * polynomials are handled greedily, the variable present in most terms is factored out first.
+     * Non-polynomial input is returned unchanged: */
+    Var horner(const Var& arg);
     /* Determines the simplest representation, currently by comparing the expanded with the
      * normalized one: */
     Var simplify(const Var& arg);
     /* The argument must be a Symbol: */
     Var diff(const Var& arg, const Var& symbol);
     bool has(const Var& arg, const Var& what);
+    /* Randomized test for zero-equivalence: rational expressions are evaluated at random points
+     * modulo large primes. A result of false is always correct, while a non-zero expression is
+     * mistaken for zero with a probability below the given bound. Other expressions are
+     * simplified and compared with zero instead: */
+    bool isZeroProbably(const Var& arg, double errorBound = 1e-12);
     bool isPositive(const Var& arg);
     bool isNegative(const Var& arg);
     unsigned complexity(const Var& arg);
@@ -3,15 +3,35 @@
 
 #include <algorithm>
 #include <cassert>
-#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include "traits.h"
 #include "var.h"
 
 namespace tsym {
-    enum class Algo { Gauss, GaussLCPivot };
+    /* Berkowitz and Laplace are division-free algorithms for determinants only, Laplace expansion
+     * being suitable for small dimensions. Solving and inverting falls back to Bareiss with them. */
+    enum class Algo { Gauss, GaussLCPivot, Bareiss, Berkowitz, Laplace };
     inline constexpr Algo defaultAlgo = Algo::GaussLCPivot;
 
+    struct SolveOptions {
+        /* Implicit, such that an algorithm can be passed wherever options are expected: */
+        SolveOptions(Algo choice = defaultAlgo)
+            : algo(choice)
+        {}
+
+        Algo algo;
+        /* Gaussian elimination simplifies every updated entry by default. If a threshold is given,
+         * updates are only simplified when their complexity exceeds it, or when they become pivot
+         * candidates or part of the pivot row. Has no effect on the other algorithms: */
+        std::optional<unsigned> simplificationThreshold;
+        /* Number of threads for the symbolic row updates during elimination and for solving
+         * multiple right hand sides, e.g. when inverting, the calling thread included: */
+        unsigned nThreads = 1;
+    };
+
     namespace detail {
         template <class SkipFieldVector, class SizeType> auto toSkipField(const SkipFieldVector& src, SizeType dim)
         {
@@ -95,76 +115,270 @@ namespace tsym {
             return result;
         }
 
-        template <class ValueType, class Vector, class SizeType>
-        void fromStdVec(std::vector<ValueType>&& src, Vector& dest, const std::vector<bool>& skip, SizeType dim)
+        inline std::vector<std::size_t> nonSkippedIndices(const std::vector<bool>& skip)
         {
-            auto value = std::move_iterator(src.begin());
+            std::vector<std::size_t> result;
 
-            for (SizeType i = 0; i < dim; ++i) {
-                if (skip[static_cast<std::size_t>(i)])
-                    continue;
-                if constexpr (hasUnaryCallOp<Vector, SizeType>)
-                    dest(i) = *value++;
-                else if (hasUnaryArrayOp<Vector, SizeType>)
-                    dest[i] = *value++;
-            }
+            for (std::size_t i = 0; i < skip.size(); ++i)
+                if (!skip[i])
+                    result.push_back(i);
+
+            return result;
         }
 
-        template <class ValueType, class Matrix, class SizeType>
-        void fromStdVec(
-          std::vector<ValueType>&& src, Matrix& dest, const std::vector<bool>& skip, SizeType nRows, SizeType nColumns)
-        {
-            auto value = std::move_iterator(src.begin());
+        /* Non-owning access to the entries of a caller's matrix, dispatched by the same traits as
+         * toStdVec. Skipped rows and columns are resolved into an index map once, and indices of
+         * the view refer to the reduced matrix. Entries are accessed through function pointers
+         * instantiated per matrix type, such that the solver itself isn't a template. A view of a
+         * const matrix must not be written to: */
+        class MatrixView {
+          public:
+            template <class Matrix, class SizeType>
+            MatrixView(Matrix& A, const std::vector<bool>& skip, SizeType dim)
+                : matrix(&A)
+                , indices(nonSkippedIndices(skip))
+                , getter([](const void* matrix, std::size_t i, std::size_t j) -> Var {
+                    const auto& A = *static_cast<const Matrix*>(matrix);
+                    const auto row = static_cast<SizeType>(i);
+                    const auto column = static_cast<SizeType>(j);
+
+                    if constexpr (hasConstBinaryCallOp<Matrix, SizeType>)
+                        return A(row, column);
+                    else
+                        return A[row][column];
+                })
+            {
+                if constexpr (!std::is_const_v<Matrix>)
+                    setter = [](const void* matrix, std::size_t i, std::size_t j, Var&& value) {
+                        auto& A = *const_cast<Matrix*>(static_cast<const Matrix*>(matrix));
+                        const auto row = static_cast<SizeType>(i);
+                        const auto column = static_cast<SizeType>(j);
+
+                        if constexpr (hasBinaryCallOp<Matrix, SizeType>)
+                            A(row, column) = std::move(value);
+                        else
+                            A[row][column] = std::move(value);
+                    };
+
+                assert(skip.size() == static_cast<std::size_t>(dim));
+            }
 
-            for (SizeType i = 0; i < nRows; ++i) {
-                if (skip[static_cast<std::size_t>(i)])
-                    continue;
+            Var operator()(std::size_t i, std::size_t j) const
+            {
+                return getter(matrix, indices[i], indices[j]);
+            }
 
-                for (SizeType j = 0; j < nColumns; ++j) {
-                    if (skip[static_cast<std::size_t>(j)])
-                        continue;
+            void set(std::size_t i, std::size_t j, Var&& value) const
+            {
+                assert(setter != nullptr);
 
-                    if constexpr (hasBinaryCallOp<Matrix, SizeType>)
-                        dest(i, j) = *value++;
-                    else if (hasBinaryArrayOp<Matrix, SizeType>)
-                        dest[i][j] = *value++;
-                }
+                setter(matrix, indices[i], indices[j], std::move(value));
             }
-        }
 
-        void invert(std::vector<Var>& A, std::size_t dim, Algo choice);
-        Var determinant(std::vector<Var>&& A, std::size_t dim, Algo choice);
-        std::vector<Var> solve(std::vector<Var>&& A, std::vector<Var>&& b, std::size_t dim, Algo choice);
+            std::size_t dim() const
+            {
+                return indices.size();
+            }
+
+          private:
+            const void* matrix;
+            std::vector<std::size_t> indices;
+            Var (*getter)(const void*, std::size_t, std::size_t);
+            void (*setter)(const void*, std::size_t, std::size_t, Var&&) = nullptr;
+        };
+
+        /* The counterpart of the above for vectors: */
+        class VectorView {
+          public:
+            template <class Vector, class SizeType>
+            VectorView(Vector& v, const std::vector<bool>& skip, SizeType dim)
+                : vector(&v)
+                , indices(nonSkippedIndices(skip))
+                , getter([](const void* vector, std::size_t i) -> Var {
+                    const auto& v = *static_cast<const Vector*>(vector);
+
+                    if constexpr (hasConstUnaryCallOp<Vector, SizeType>)
+                        return v(static_cast<SizeType>(i));
+                    else
+                        return v[static_cast<SizeType>(i)];
+                })
+            {
+                if constexpr (!std::is_const_v<Vector>)
+                    setter = [](const void* vector, std::size_t i, Var&& value) {
+                        auto& v = *const_cast<Vector*>(static_cast<const Vector*>(vector));
+
+                        if constexpr (hasUnaryCallOp<Vector, SizeType>)
+                            v(static_cast<SizeType>(i)) = std::move(value);
+                        else
+                            v[static_cast<SizeType>(i)] = std::move(value);
+                    };
+
+                assert(skip.size() == static_cast<std::size_t>(dim));
+            }
+
+            Var operator()(std::size_t i) const
+            {
+                return getter(vector, indices[i]);
+            }
+
+            void set(std::size_t i, Var&& value) const
+            {
+                assert(setter != nullptr);
+
+                setter(vector, indices[i], std::move(value));
+            }
+
+            std::size_t dim() const
+            {
+                return indices.size();
+            }
+
+          private:
+            const void* vector;
+            std::vector<std::size_t> indices;
+            Var (*getter)(const void*, std::size_t);
+            void (*setter)(const void*, std::size_t, Var&&) = nullptr;
+        };
+
+        /* Both functions read the entries of the view only once, the inverse and the solution are
+         * moved into the caller's storage: */
+        void invert(const MatrixView& A, const SolveOptions& options);
+        void solve(const MatrixView& A, const VectorView& b, const VectorView& x, const SolveOptions& options);
+        Var determinant(const MatrixView& A, Algo choice);
+        Var characteristicPolynomial(std::vector<Var>&& A, std::size_t dim, const Var& variable);
+        std::vector<Var> solve(
+          std::vector<Var>&& A, std::vector<Var>&& b, std::size_t dim, const SolveOptions& options);
     }
 
+    class Factorization {
+        /* Factorization of a square coefficient matrix to be reused for multiple right hand sides,
+         * the determinant or the inverse. With Gaussian elimination, this is an LU decomposition
+         * with partial pivoting, with Algo::Bareiss, the fraction-free multipliers and pivots are
+         * stored instead. Right hand sides are permuted according to the recorded row swaps. A
+         * singular matrix throws a std::invalid_argument when solving. Matrices of numbers only are
+         * always factorized without any symbolic arithmetic: rationals by fraction-free
+         * elimination on integers after scaling each row, floating point numbers by Gaussian
+         * elimination. Right hand sides of numbers only are then solved on plain numbers, too. */
+      public:
+        template <class Matrix, typename SizeType>
+        Factorization(const Matrix& A, SizeType dim, const SolveOptions& options = {})
+            : opts(options)
+        {
+            const auto skip = detail::defaultSkip(dim);
+
+            factorize(detail::toStdVec<Var>(A, skip, dim, dim), static_cast<std::size_t>(dim));
+        }
+
+        std::vector<Var> solve(const std::vector<Var>& rhs) const;
+        /* Each element of the argument is one right hand side column, the result contains the
+         * corresponding solution columns: */
+        std::vector<std::vector<Var>> solve(const std::vector<std::vector<Var>>& rhsColumns) const;
+        Var determinant() const;
+        /* The result is a vector of rows: */
+        std::vector<std::vector<Var>> inverse() const;
+
+        std::size_t dim() const;
+        /* Row i of the factorized matrix is row permutation()[i] of the original one: */
+        const std::vector<std::size_t>& permutation() const;
+
+      private:
+        friend class ParametricSolver;
+        friend void detail::invert(const detail::MatrixView&, const SolveOptions&);
+        friend Var detail::determinant(const detail::MatrixView&, Algo);
+        friend std::vector<Var> detail::solve(std::vector<Var>&&, std::vector<Var>&&, std::size_t, const SolveOptions&);
+
+        enum class Kernel { Symbolic, Integer, Floating };
+
+        /* Takes over a matrix in row-major order without copying its entries: */
+        Factorization(std::vector<Var>&& A, std::size_t dim, const SolveOptions& options);
+
+        void factorize(std::vector<Var>&& A, std::size_t dimension);
+
+        SolveOptions opts;
+        Kernel kernel = Kernel::Symbolic;
+        std::vector<Var> rowScales;
+        std::size_t n = 0;
+        std::vector<Var> lu;
+        std::vector<std::size_t> perm;
+        unsigned nRowSwaps = 0;
+    };
+
+    class ParametricSolver {
+        /* Solves a linear system for many sets of numeric values of the parameters it depends on.
+         * The coefficient matrix is prepared once, with its entries converted into Horner schemes
+         * and constant entries evaluated in advance. Each set of values then only requires walking
+         * the entries to evaluate them, without any substitution or simplification, and solving
+         * the resulting matrix of numbers like a Factorization does. Instances with values that
+         * aren't numbers are substituted and solved symbolically instead. A singular instance
+         * throws a std::invalid_argument. The number of threads in the options is used to solve
+         * a batch of instances. */
+      public:
+        template <class Matrix, typename SizeType>
+        ParametricSolver(
+          const Matrix& A, SizeType dim, const std::vector<Var>& parameters, const SolveOptions& options = {})
+            : opts(options)
+            , params(parameters)
+        {
+            const auto skip = detail::defaultSkip(dim);
+
+            prepare(detail::toStdVec<Var>(A, skip, dim, dim), static_cast<std::size_t>(dim));
+        }
+
+        /* The right hand side may depend on the parameters, too. Each element of parameterValues
+         * holds values in the order of the parameters passed to the constructor, and the solutions
+         * are returned in the same order: */
+        std::vector<std::vector<Var>> solve(
+          const std::vector<Var>& rhs, const std::vector<std::vector<Var>>& parameterValues) const;
+
+        std::size_t dim() const;
+
+      private:
+        void prepare(std::vector<Var>&& A, std::size_t dimension);
+        std::optional<std::vector<Var>> solveNumerically(
+          const std::vector<Var>& rhs, const std::vector<Var>& values) const;
+        std::vector<Var> solveBySubstitution(const std::vector<Var>& rhs, const std::vector<Var>& values) const;
+
+        SolveOptions opts;
+        std::vector<Var> params;
+        std::size_t n = 0;
+        std::vector<Var> original;
+        std::vector<Var> compiled;
+    };
+
     template <class Matrix, class RhsVector, class SolutionVector, class SkipField, typename SizeType>
     void solve(const Matrix& A, const RhsVector& b, SolutionVector& x, const SkipField& sf, SizeType dim,
-      Algo choice = defaultAlgo)
+      const SolveOptions& options)
     {
         const std::vector<bool> skip = detail::toSkipField(sf, dim);
-        std::vector<Var> coeff = detail::toStdVec<Var>(A, skip, dim, dim);
-        std::vector<Var> rhs = detail::toStdVec<Var>(b, skip, dim);
-        const std::size_t reducedDim = rhs.size();
 
-        std::vector<Var> result = detail::solve(std::move(coeff), std::move(rhs), reducedDim, choice);
+        detail::solve({A, skip, dim}, {b, skip, dim}, {x, skip, dim}, options);
+    }
 
-        detail::fromStdVec(std::move(result), x, skip, dim);
+    template <class Matrix, class RhsVector, class SolutionVector, typename SizeType>
+    void solve(const Matrix& A, const RhsVector& b, SolutionVector& x, SizeType dim, const SolveOptions& options)
+    {
+        solve(A, b, x, detail::defaultSkip(dim), dim, options);
+    }
+
+    template <class Matrix, class RhsVector, class SolutionVector, class SkipField, typename SizeType>
+    void solve(const Matrix& A, const RhsVector& b, SolutionVector& x, const SkipField& sf, SizeType dim,
+      Algo choice = defaultAlgo)
+    {
+        solve(A, b, x, sf, dim, SolveOptions(choice));
     }
 
     template <class Matrix, class RhsVector, class SolutionVector, typename SizeType>
     void solve(const Matrix& A, const RhsVector& b, SolutionVector& x, SizeType dim, Algo choice = defaultAlgo)
     {
-        solve(A, b, x, detail::defaultSkip(dim), dim, choice);
+        solve(A, b, x, detail::defaultSkip(dim), dim, SolveOptions(choice));
     }
 
     template <class Matrix, class SkipField, typename SizeType>
     Var determinant(const Matrix& A, const SkipField& sf, SizeType dim, Algo choice = defaultAlgo)
     {
         const std::vector<bool> skip = detail::toSkipField(sf, dim);
-        const auto reducedDim = std::count(skip.cbegin(), skip.cend(), false);
-        std::vector<Var> vecA = detail::toStdVec<Var>(A, skip, dim, dim);
 
-        return detail::determinant(std::move(vecA), static_cast<std::size_t>(reducedDim), choice);
+        return detail::determinant({A, skip, dim}, choice);
     }
 
     template <class Matrix, typename SizeType> Var determinant(const Matrix& A, SizeType dim, Algo choice = defaultAlgo)
@@ -172,21 +386,40 @@ namespace tsym {
         return determinant(A, detail::defaultSkip(dim), dim, choice);
     }
 
+    /* Returns det(variable*I - A) in expanded form, computed by Berkowitz' division-free
+     * algorithm: */
+    template <class Matrix, typename SizeType>
+    Var characteristicPolynomial(const Matrix& A, const Var& variable, SizeType dim)
+    {
+        const auto skip = detail::defaultSkip(dim);
+        std::vector<Var> vecA = detail::toStdVec<Var>(A, skip, dim, dim);
+
+        return detail::characteristicPolynomial(std::move(vecA), static_cast<std::size_t>(dim), variable);
+    }
+
+    /* The inverse is written into the given matrix, whose entries are read only once: */
     template <class Matrix, class SkipField, typename SizeType>
-    void invert(Matrix& A, const SkipField& sf, SizeType dim, Algo choice = defaultAlgo)
+    void invert(Matrix& A, const SkipField& sf, SizeType dim, const SolveOptions& options)
     {
         const std::vector<bool> skip = detail::toSkipField(sf, dim);
-        const auto reducedDim = std::count(skip.cbegin(), skip.cend(), false);
-        std::vector<Var> vecA = detail::toStdVec<Var>(A, skip, dim, dim);
 
-        detail::invert(vecA, static_cast<std::size_t>(reducedDim), choice);
+        detail::invert({A, skip, dim}, options);
+    }
+
+    template <class Matrix, typename SizeType> void invert(Matrix& A, SizeType dim, const SolveOptions& options)
+    {
+        invert(A, detail::defaultSkip(dim), dim, options);
+    }
 
-        detail::fromStdVec(std::move(vecA), A, skip, dim, dim);
+    template <class Matrix, class SkipField, typename SizeType>
+    void invert(Matrix& A, const SkipField& sf, SizeType dim, Algo choice = defaultAlgo)
+    {
+        invert(A, sf, dim, SolveOptions(choice));
     }
 
     template <class Matrix, typename SizeType> void invert(Matrix& A, SizeType dim, Algo choice = defaultAlgo)
     {
-        return invert(A, detail::defaultSkip(dim), dim, choice);
+        invert(A, detail::defaultSkip(dim), dim, SolveOptions(choice));
     }
 }
 
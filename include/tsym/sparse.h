@@ -0,0 +1,58 @@
+#ifndef TSYM_SPARSE_H
+#define TSYM_SPARSE_H
+
+#include <cstddef>
+#include <vector>
+#include "var.h"
+
+namespace tsym {
+    struct SparsityPattern {
+        /* Compressed sparse row (CSR) structure of a matrix: the column indices of the non-zero
+         * entries in row i are stored in columnIndices, starting at position rowPointers[i] up to
+         * (excluding) rowPointers[i + 1]. Column indices of one row are sorted in ascending order.
+         * The rowPointers vector thus always has nRows + 1 entries. */
+        std::size_t nRows = 0;
+        std::size_t nColumns = 0;
+        std::vector<std::size_t> rowPointers{0};
+        std::vector<std::size_t> columnIndices;
+    };
+
+    struct CsrMatrix {
+        /* Sparse matrix of expressions, values[k] is the entry at row i and column
+         * pattern.columnIndices[k], where k is in the range given by pattern.rowPointers for row
+         * i. Entries not present in the pattern are zero. */
+        SparsityPattern pattern;
+        std::vector<Var> values;
+    };
+
+    struct Triplet {
+        std::size_t row;
+        std::size_t column;
+        Var value;
+    };
+
+    /* Assembles a sparse matrix from (row, column, value) triplets in arbitrary order. Values of
+     * duplicate positions are summed up, and entries that are zero are dropped: */
+    CsrMatrix fromTriplets(std::size_t nRows, std::size_t nColumns, const std::vector<Triplet>& triplets);
+    /* Solves A*x = b for a square sparse matrix by Gaussian elimination. The pivot of each step is
+     * chosen by the Markowitz criterion to limit fill-in, ties are broken by least complexity of
+     * the pivot entry. Only non-zero entries are stored and updated. Throws a
+     * std::invalid_argument if the matrix is singular: */
+    std::vector<Var> solve(const CsrMatrix& A, const std::vector<Var>& b);
+
+    /* Determines the non-zero structure of the Jacobian of the given functions with respect to the
+     * given symbols without differentiating anything. The entry (i, j) is structurally non-zero if
+     * functions[i] depends on symbols[j]. */
+    SparsityPattern jacobianPattern(const std::vector<Var>& functions, const std::vector<Var>& symbols);
+    /* Returns the Jacobian with one row per function and one column per symbol. Only structurally
+     * non-zero entries are differentiated, and entries that turn out to be zero after
+     * differentiation are dropped from the result: */
+    CsrMatrix jacobian(const std::vector<Var>& functions, const std::vector<Var>& symbols);
+    /* Greedy coloring of the columns of the given pattern, such that no two columns with the same
+     * color have a non-zero entry in the same row. The result contains one color per column,
+     * starting at zero. Columns of the same color can be evaluated together, e.g. by compressed
+     * numerical differentiation. */
+    std::vector<std::size_t> colorColumns(const SparsityPattern& pattern);
+}
+
+#endif
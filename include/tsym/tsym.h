@@ -7,6 +7,7 @@
 #include "plaintextprintengine.h"
 #include "printengine.h"
 #include "solve.h"
+#include "sparse.h"
 #include "var.h"
 #include "version.h"
 
@@ -91,6 +91,14 @@ tsym::BasePtr tsym::Base::subst(const Base& from, const BasePtr& to) const
         return clone();
 }
 
+tsym::BasePtr tsym::Base::subst(const BasePtrMap& replacements) const
+{
+    if (const auto lookup = replacements.find(clone()); lookup != cend(replacements))
+        return lookup->second;
+    else
+        return clone();
+}
+
 tsym::BasePtr tsym::Base::coeff(const Base& variable, int exp) const
 {
     if (isEqual(variable))
@@ -146,8 +154,8 @@ tsym::BasePtr tsym::Base::normal() const
 
 tsym::BasePtr tsym::Base::normalViaCache() const
 {
-    static RegisteredCache<BasePtr, BasePtr> cache;
-    static auto& map(cache.map);
+    thread_local RegisteredCache<BasePtr, BasePtr> cache;
+    thread_local auto& map(cache.map);
     const BasePtr key = clone();
 
     if (const auto lookup = map.find(key); lookup != cend(map))
@@ -59,6 +59,9 @@ namespace tsym {
         virtual BasePtr nonConstTerm() const;
         virtual BasePtr expand() const;
         virtual BasePtr subst(const Base& from, const BasePtr& to) const;
+        /* Replaces all keys of the map in one traversal. Composites are only recreated (and thus
+         * simplified) if at least one operand has changed: */
+        virtual BasePtr subst(const BasePtrMap& replacements) const;
         virtual BasePtr coeff(const Base& variable, int exp) const;
         virtual BasePtr leadingCoeff(const Base& variable) const;
         virtual int degree(const Base& variable) const;
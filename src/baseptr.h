@@ -3,6 +3,7 @@
 
 #include <functional>
 #include <memory>
+#include <unordered_map>
 
 namespace tsym {
     class Base;
@@ -30,4 +31,9 @@ namespace std {
     };
 }
 
+namespace tsym {
+    /* Keys are compared by value, too, so this is suitable for replacing subexpressions: */
+    using BasePtrMap = std::unordered_map<BasePtr, BasePtr>;
+}
+
 #endif
@@ -152,8 +152,8 @@ namespace tsym {
 
 tsym::BasePtr tsym::expandAsProduct(const BasePtrList& list)
 {
-    static RegisteredCache<BasePtrList, BasePtr> cache;
-    static auto& map(cache.map);
+    thread_local RegisteredCache<BasePtrList, BasePtr> cache;
+    thread_local auto& map(cache.map);
     const auto lookup = map.find(list);
     BasePtr expanded;
     BasePtrList sums;
@@ -193,3 +193,21 @@ tsym::BasePtrList tsym::subst(const BasePtrList& list, const Base& from, const B
 
     return res;
 }
+
+std::optional<tsym::BasePtrList> tsym::subst(const BasePtrList& list, const BasePtrMap& replacements)
+{
+    BasePtrList res;
+    bool hasChanged = false;
+
+    for (const auto& item : list) {
+        res.push_back(item->subst(replacements));
+
+        /* Pointer comparison is sufficient, as unaffected items are returned as they are: */
+        hasChanged = hasChanged || res.back() != item;
+    }
+
+    if (hasChanged)
+        return res;
+    else
+        return std::nullopt;
+}
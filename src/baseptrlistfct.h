@@ -1,6 +1,7 @@
 #ifndef TSYM_BASEPTRLISTFCT_H
 #define TSYM_BASEPTRLISTFCT_H
 
+#include <optional>
 #include "baseptr.h"
 #include "baseptrlist.h"
 
@@ -32,6 +33,8 @@ namespace tsym {
     void subst(BasePtrList& list, const Base& from, const BasePtr& to);
     /* Substitute after copying the container: */
     [[nodiscard]] BasePtrList subst(const BasePtrList& list, const Base& from, const BasePtr& to);
+    /* Substitute all keys of the map, returns std::nullopt if no item has changed: */
+    std::optional<BasePtrList> subst(const BasePtrList& list, const BasePtrMap& replacements);
 }
 
 #endif
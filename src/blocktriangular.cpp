@@ -0,0 +1,146 @@
+
+#include "blocktriangular.h"
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+namespace tsym {
+    namespace {
+        constexpr std::size_t unmatched = std::numeric_limits<std::size_t>::max();
+
+        class Matching {
+          public:
+            explicit Matching(const SparsityPattern& structure)
+                : rowOfColumn(structure.nColumns, unmatched)
+                , pattern(structure)
+                , visited(structure.nColumns, unmatched)
+            {}
+
+            bool augment(std::size_t row)
+            /* Depth-first search for an augmenting path starting at the given unmatched row. Columns
+             * are marked with the row that started the search to avoid resetting them. */
+            {
+                return augment(row, row);
+            }
+
+            std::vector<std::size_t> rowOfColumn;
+
+          private:
+            bool augment(std::size_t row, std::size_t origin)
+            {
+                for (std::size_t k = pattern.rowPointers[row]; k < pattern.rowPointers[row + 1]; ++k)
+                    if (const std::size_t j = pattern.columnIndices[k]; rowOfColumn[j] == unmatched) {
+                        rowOfColumn[j] = row;
+                        return true;
+                    }
+
+                for (std::size_t k = pattern.rowPointers[row]; k < pattern.rowPointers[row + 1]; ++k) {
+                    const std::size_t j = pattern.columnIndices[k];
+
+                    if (visited[j] == origin)
+                        continue;
+
+                    visited[j] = origin;
+
+                    if (augment(rowOfColumn[j], origin)) {
+                        rowOfColumn[j] = row;
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            const SparsityPattern& pattern;
+            std::vector<std::size_t> visited;
+        };
+
+        class StrongComponents {
+            /* Tarjan's algorithm on the graph with an edge from column j to column k if the row
+             * matched with j has a non-zero entry in column k. Components are emitted after all
+             * components reachable from them, which is the order of solving. */
+          public:
+            StrongComponents(const SparsityPattern& structure, const std::vector<std::size_t>& matching)
+                : pattern(structure)
+                , rowOfColumn(matching)
+                , index(structure.nColumns, unvisited)
+                , lowLink(structure.nColumns, 0)
+                , isOnStack(structure.nColumns, false)
+            {}
+
+            std::vector<std::vector<std::size_t>> compute()
+            {
+                for (std::size_t j = 0; j < pattern.nColumns; ++j)
+                    if (index[j] == unvisited)
+                        visit(j);
+
+                return std::move(blocks);
+            }
+
+          private:
+            void visit(std::size_t j)
+            {
+                const std::size_t row = rowOfColumn[j];
+
+                index[j] = lowLink[j] = counter++;
+                stack.push_back(j);
+                isOnStack[j] = true;
+
+                for (std::size_t k = pattern.rowPointers[row]; k < pattern.rowPointers[row + 1]; ++k) {
+                    const std::size_t next = pattern.columnIndices[k];
+
+                    if (index[next] == unvisited) {
+                        visit(next);
+                        lowLink[j] = std::min(lowLink[j], lowLink[next]);
+                    } else if (isOnStack[next])
+                        lowLink[j] = std::min(lowLink[j], index[next]);
+                }
+
+                if (lowLink[j] == index[j])
+                    popComponent(j);
+            }
+
+            void popComponent(std::size_t root)
+            {
+                std::vector<std::size_t> component;
+                std::size_t j;
+
+                do {
+                    j = stack.back();
+                    stack.pop_back();
+                    isOnStack[j] = false;
+                    component.push_back(j);
+                } while (j != root);
+
+                std::sort(begin(component), end(component));
+
+                blocks.push_back(std::move(component));
+            }
+
+            static constexpr std::size_t unvisited = std::numeric_limits<std::size_t>::max();
+            const SparsityPattern& pattern;
+            const std::vector<std::size_t>& rowOfColumn;
+            std::vector<std::size_t> index;
+            std::vector<std::size_t> lowLink;
+            std::vector<bool> isOnStack;
+            std::vector<std::size_t> stack;
+            std::vector<std::vector<std::size_t>> blocks;
+            std::size_t counter = 0;
+        };
+    }
+}
+
+std::optional<tsym::BlockTriangularForm> tsym::blockTriangularForm(const SparsityPattern& pattern)
+{
+    Matching matching(pattern);
+
+    assert(pattern.nRows == pattern.nColumns);
+
+    for (std::size_t i = 0; i < pattern.nRows; ++i)
+        if (!matching.augment(i))
+            return std::nullopt;
+
+    std::vector<std::vector<std::size_t>> blocks = StrongComponents(pattern, matching.rowOfColumn).compute();
+
+    return BlockTriangularForm{std::move(matching.rowOfColumn), std::move(blocks)};
+}
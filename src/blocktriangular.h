@@ -0,0 +1,24 @@
+#ifndef TSYM_BLOCKTRIANGULAR_H
+#define TSYM_BLOCKTRIANGULAR_H
+
+#include <optional>
+#include <vector>
+#include "sparse.h"
+
+namespace tsym {
+    struct BlockTriangularForm {
+        /* Permutation of a square matrix to block lower triangular form: rowOfColumn[j] is the
+         * row matched with column j, i.e., the permuted matrix has only non-zero entries on its
+         * diagonal. The blocks contain column indices of strongly connected components, ordered
+         * such that each block only depends on columns of preceding blocks. */
+        std::vector<std::size_t> rowOfColumn;
+        std::vector<std::vector<std::size_t>> blocks;
+    };
+
+    /* Computes a maximum matching of rows and columns by augmenting paths and the strongly
+     * connected components of the resulting column graph by Tarjan's algorithm. Returns nothing if
+     * the pattern is structurally singular: */
+    std::optional<BlockTriangularForm> blockTriangularForm(const SparsityPattern& pattern);
+}
+
+#endif
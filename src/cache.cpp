@@ -1,6 +1,7 @@
 
 #include "cache.h"
 #include <map>
+#include <mutex>
 
 namespace {
     auto& clearFunctions()
@@ -9,20 +10,33 @@ namespace {
 
         return clearFunctions;
     }
+
+    std::mutex& clearFunctionsMutex()
+    {
+        static std::mutex mutex;
+
+        return mutex;
+    }
 }
 
 void tsym::detail::registerCacheClearer(const short* address, std::function<void()>&& fct)
 {
+    std::lock_guard<std::mutex> lock(clearFunctionsMutex());
+
     clearFunctions()[address] = std::move(fct);
 }
 
 void tsym::detail::deregisterCacheClearer(const short* address)
 {
+    std::lock_guard<std::mutex> lock(clearFunctionsMutex());
+
     clearFunctions().erase(address);
 }
 
 void tsym::clearRegisteredCaches()
 {
+    std::lock_guard<std::mutex> lock(clearFunctionsMutex());
+
     for ([[maybe_unused]] auto& [unused, clearFctEntry] : clearFunctions())
         clearFctEntry();
 }
@@ -7,6 +7,8 @@
 #include <unordered_map>
 
 namespace tsym {
+    /* Caches are thread-local, this clears the caches of all threads. It must hence not be called
+     * while other threads are using theirs: */
     void clearRegisteredCaches();
 
     namespace detail {
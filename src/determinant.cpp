@@ -0,0 +1,127 @@
+
+#include "determinant.h"
+#include <cassert>
+#include <cstdint>
+#include "functions.h"
+
+namespace tsym {
+    namespace {
+        std::vector<Var> multiply(const std::vector<Var>& row, const SquareMatrixAdaptor<>& A, std::size_t dim)
+        /* Row vector times the leading dim x dim submatrix of A: */
+        {
+            std::vector<Var> result(dim, 0);
+
+            for (std::size_t j = 0; j < dim; ++j) {
+                for (std::size_t k = 0; k < dim; ++k)
+                    if (row[k] != 0 && A(k, j) != 0)
+                        result[j] += row[k] * A(k, j);
+
+                result[j] = expand(result[j]);
+            }
+
+            return result;
+        }
+
+        Var dot(const std::vector<Var>& row, const SquareMatrixAdaptor<>& A, std::size_t column)
+        {
+            Var result(0);
+
+            for (std::size_t k = 0; k < row.size(); ++k)
+                if (row[k] != 0 && A(k, column) != 0)
+                    result += row[k] * A(k, column);
+
+            return expand(result);
+        }
+
+        std::vector<Var> toeplitzColumn(const SquareMatrixAdaptor<>& A, std::size_t r)
+        /* First column of the lower triangular Toeplitz matrix of step r, i.e., with the leading
+         * r x r submatrix M, the remainder R of row r and S of column r: 1, -A(r, r), -R*S,
+         * -R*M*S, ..., -R*M^(r - 1)*S. */
+        {
+            std::vector<Var> result{1, -A(r, r)};
+            std::vector<Var> row;
+
+            for (std::size_t k = 0; k < r; ++k)
+                row.push_back(A(r, k));
+
+            for (std::size_t power = 0; power < r; ++power) {
+                result.push_back(-dot(row, A, r));
+
+                if (power + 1 < r)
+                    row = multiply(row, A, r);
+            }
+
+            return result;
+        }
+    }
+}
+
+std::vector<tsym::Var> tsym::characteristicCoefficients(const SquareMatrixAdaptor<>& A)
+{
+    std::vector<Var> coeffs{1};
+
+    for (std::size_t r = 0; r < A.dim; ++r) {
+        const std::vector<Var> toeplitz = toeplitzColumn(A, r);
+        std::vector<Var> next(coeffs.size() + 1, 0);
+
+        for (std::size_t i = 0; i < next.size(); ++i) {
+            for (std::size_t k = 0; k < coeffs.size() && k <= i; ++k)
+                if (toeplitz[i - k] != 0 && coeffs[k] != 0)
+                    next[i] += toeplitz[i - k] * coeffs[k];
+
+            next[i] = expand(next[i]);
+        }
+
+        coeffs = std::move(next);
+    }
+
+    return coeffs;
+}
+
+tsym::Var tsym::berkowitzDeterminant(const SquareMatrixAdaptor<>& A)
+{
+    const Var last = characteristicCoefficients(A).back();
+
+    return A.dim % 2 == 0 ? last : expand(-last);
+}
+
+tsym::Var tsym::laplaceDeterminant(const SquareMatrixAdaptor<>& A)
+/* The minor of a column set with k elements is the determinant of the last k rows restricted to
+ * these columns. Masks are processed in ascending order, such that all minors of smaller column
+ * sets are known. */
+{
+    const std::size_t dim = A.dim;
+    const std::uint64_t nMasks = std::uint64_t{1} << dim;
+    std::vector<Var> minors(nMasks, 0);
+
+    assert(dim < 64);
+
+    minors[0] = 1;
+
+    for (std::uint64_t mask = 1; mask < nMasks; ++mask) {
+        std::size_t nColumns = 0;
+        Var minor(0);
+
+        for (std::size_t j = 0; j < dim; ++j)
+            nColumns += (mask >> j) & 1;
+
+        const std::size_t row = dim - nColumns;
+
+        for (std::size_t j = 0, position = 0; j < dim; ++j) {
+            if (((mask >> j) & 1) == 0)
+                continue;
+
+            if (const Var& entry = A(row, j); entry != 0 && minors[mask ^ (std::uint64_t{1} << j)] != 0) {
+                const Var term = entry * minors[mask ^ (std::uint64_t{1} << j)];
+
+                minor += position % 2 == 0 ? term : -term;
+            }
+
+            ++position;
+        }
+
+        minors[mask] = expand(minor);
+    }
+
+    return minors[nMasks - 1];
+}
@@ -0,0 +1,23 @@
+#ifndef TSYM_DETERMINANT_H
+#define TSYM_DETERMINANT_H
+
+#include <vector>
+#include "stdvecwrapper.h"
+
+namespace tsym {
+    /* Division-free algorithms for determinants, which only add and multiply entries and expand
+     * intermediate results. For polynomial entries, no rational functions and hence no gcd
+     * computations are involved. */
+
+    /* Coefficients of det(x*I - A) in descending order of the power of x by Berkowitz' algorithm,
+     * which requires O(n^4) multiplications. The first coefficient is thus always one, the last
+     * one (-1)^n*det(A): */
+    std::vector<Var> characteristicCoefficients(const SquareMatrixAdaptor<>& A);
+    Var berkowitzDeterminant(const SquareMatrixAdaptor<>& A);
+    /* Laplace expansion along the rows, where the minors of the trailing rows are memoized by the
+     * bitmask of their columns. This requires O(n*2^n) multiplications and is only suitable for
+     * small dimensions: */
+    Var laplaceDeterminant(const SquareMatrixAdaptor<>& A);
+}
+
+#endif
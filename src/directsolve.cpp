@@ -1,13 +1,29 @@
 
 #include "directsolve.h"
 #include <limits>
+#include <numeric>
 #include <stdexcept>
 #include "functions.h"
+#include "numberfct.h"
+#include "options.h"
+#include "parallel.h"
+#include "poly.h"
+#include "polyinfo.h"
+#include "zerotest.h"
+
+bool tsym::isZeroEntry(const Var& entry)
+/* Entries that are zero, but not in their simplest form, are detected by a cheap probabilistic
+ * test. A non-zero result is always correct, while a non-zero entry is mistaken for zero with a
+ * probability below the configured error bound, which can lead to a bad pivot choice or a matrix
+ * wrongly considered singular. */
+{
+    return entry == 0 || isZeroModular(*entry.get(), options::getZeroTestErrorBound()).value_or(false);
+}
 
 std::size_t tsym::firstNonZeroPivot(const SquareMatrixAdaptor<>& coeff, std::size_t row)
 {
     for (std::size_t i = row; i < coeff.dim; ++i)
-        if (coeff(i, row) != 0)
+        if (!isZeroEntry(coeff(i, row)))
             return i;
 
     throw std::invalid_argument("Coefficient matrix is singular");
@@ -22,9 +38,11 @@ std::size_t tsym::leastComplexityPivot(const SquareMatrixAdaptor<>& coeff, std::
 
     for (std::size_t i = row; i < coeff.dim; ++i) {
         const Var& diag = coeff(i, row);
-        const unsigned comp = complexity(diag);
 
-        if (diag != 0 && comp < leastComplexity) {
+        if (isZeroEntry(diag))
+            continue;
+
+        if (const unsigned comp = complexity(diag); comp < leastComplexity) {
             leastComplexity = comp;
             idx = i;
         }
@@ -35,67 +53,328 @@ std::size_t tsym::leastComplexityPivot(const SquareMatrixAdaptor<>& coeff, std::
 
 namespace tsym {
     namespace {
-        void swapRows(SquareMatrixAdaptor<>& coeff, std::size_t from, std::size_t to)
+        template <class T>
+        void swapRows(SquareMatrixAdaptor<T>& coeff, Permutation& permutation, std::size_t from, std::size_t to)
         {
             for (std::size_t j = 0; j < coeff.dim; ++j)
                 std::swap(coeff(from, j), coeff(to, j));
+
+            std::swap(permutation[from], permutation[to]);
+        }
+
+        Permutation identity(std::size_t dim)
+        {
+            Permutation result(dim);
+
+            std::iota(begin(result), end(result), 0);
+
+            return result;
+        }
+
+        void permute(VectorAdaptor<>& v, const Permutation& permutation)
+        {
+            const std::vector<Var> orig = v.data;
+
+            for (std::size_t i = 0; i < permutation.size(); ++i)
+                v(i) = orig[permutation[i]];
+        }
+
+        Var divideExact(const Var& numerator, const Var& divisor)
+        /* In fraction-free elimination, the division is known to be exact. For polynomial entries,
+         * the quotient is hence computed by polynomial division without any normalization. */
+        {
+            const Var expanded = expand(numerator);
+
+            if (divisor == 1 || expanded == 0)
+                return expanded;
+            else if (poly::isInputValid(*expanded.get(), *divisor.get()))
+                if (const BasePtrList qr = poly::divide(expanded.get(), divisor.get()); Var(qr.back()) == 0)
+                    return Var(qr.front());
+
+            return simplify(numerator / divisor);
         }
 
-        void swapScalar(VectorAdaptor<>& v, std::size_t from, std::size_t to)
+        void simplifyPivotCandidates(SquareMatrixAdaptor<>& coeff, std::size_t column, unsigned nThreads)
         {
-            std::swap(v(from), v(to));
+            parallelFor(coeff.dim - column, nThreads, [&coeff, column](std::size_t row) {
+                coeff(column + row, column) = simplify(coeff(column + row, column));
+            });
+        }
+
+        void substituteBackward(const SquareMatrixAdaptor<>& coeff, const VectorAdaptor<>& rhs, VectorAdaptor<>& x)
+        {
+            const std::size_t dim = coeff.dim;
+
+            for (std::size_t i = 0; i < dim; ++i)
+                x(i) = 0;
+
+            for (std::size_t i = dim - 1; i + 1 > 0; --i) {
+                const Var diag = simplify(coeff(i, i));
+
+                for (std::size_t j = i + 1; j < dim; ++j)
+                    x(i) -= coeff(i, j) * x(j);
+
+                if (diag == 0)
+                    throw std::invalid_argument("Coefficient matrix is singular");
+
+                x(i) = simplify((rhs(i) + x(i)) / diag);
+            }
         }
     }
 }
 
-unsigned tsym::eliminateGauss(SquareMatrixAdaptor<>& coeff, std::optional<VectorAdaptor<>>& rhs, PivotStrategy piv)
+unsigned tsym::factorizeGauss(SquareMatrixAdaptor<>& coeff, Permutation& permutation, PivotStrategy piv,
+  std::optional<unsigned> simplificationThreshold, unsigned nThreads)
 {
     const std::size_t dim = coeff.dim;
+    const bool isDeferred = simplificationThreshold.has_value();
     unsigned rowSwaps = 0;
 
+    permutation = identity(dim);
+
     for (std::size_t j = 0; j + 1 < dim; ++j) {
-        const std::size_t pivIndex = piv(coeff, j);
+        if (isDeferred)
+            simplifyPivotCandidates(coeff, j, nThreads);
 
-        if (pivIndex != j) {
+        if (const std::size_t pivIndex = piv(coeff, j); pivIndex != j) {
             ++rowSwaps;
+            swapRows(coeff, permutation, j, pivIndex);
+        }
+
+        if (isDeferred)
+            parallelFor(dim - j - 1, nThreads, [&coeff, j](std::size_t k) {
+                coeff(j, j + 1 + k) = simplify(coeff(j, j + 1 + k));
+            });
+
+        parallelFor(dim - j - 1, nThreads, [&coeff, &simplificationThreshold, isDeferred, dim, j](std::size_t row) {
+            const std::size_t i = j + 1 + row;
 
-            swapRows(coeff, j, pivIndex);
+            if (isZeroEntry(coeff(i, j))) {
+                /* Nothing to eliminate, the row remains unchanged: */
+                coeff(i, j) = 0;
+                return;
+            }
 
-            if (rhs)
-                swapScalar(*rhs, j, pivIndex);
+            coeff(i, j) = simplify(coeff(i, j) / coeff(j, j));
+
+            for (std::size_t k = j + 1; k < dim; ++k) {
+                const Var update = coeff(i, k) - coeff(i, j) * coeff(j, k);
+
+                if (isZeroEntry(update))
+                    coeff(i, k) = 0;
+                else if (isDeferred && complexity(update) <= *simplificationThreshold)
+                    coeff(i, k) = update;
+                else
+                    coeff(i, k) = simplify(update);
+            }
+        });
+    }
+
+    if (isDeferred && dim > 0)
+        simplifyPivotCandidates(coeff, dim - 1, nThreads);
+
+    return rowSwaps;
+}
+
+unsigned tsym::eliminateGauss(SquareMatrixAdaptor<>& coeff, std::optional<VectorAdaptor<>>& rhs, PivotStrategy piv)
+{
+    Permutation permutation;
+    const unsigned rowSwaps = factorizeGauss(coeff, permutation, piv);
+
+    if (rhs)
+        permute(*rhs, permutation);
+
+    return rowSwaps;
+}
+
+unsigned tsym::factorizeBareiss(
+  SquareMatrixAdaptor<>& coeff, Permutation& permutation, PivotStrategy piv, unsigned nThreads)
+{
+    const std::size_t dim = coeff.dim;
+    unsigned rowSwaps = 0;
+    Var previousPivot(1);
+
+    permutation = identity(dim);
+
+    for (std::size_t j = 0; j + 1 < dim; ++j) {
+        if (const std::size_t pivIndex = piv(coeff, j); pivIndex != j) {
+            ++rowSwaps;
+            swapRows(coeff, permutation, j, pivIndex);
+        }
+
+        if (isZeroEntry(coeff(j, j))) {
+            coeff(dim - 1, dim - 1) = 0;
+            return rowSwaps;
         }
 
+        const Var& pivot = coeff(j, j) = expand(coeff(j, j));
+
+        parallelFor(dim - j - 1, nThreads, [&coeff, &pivot, &previousPivot, dim, j](std::size_t row) {
+            const std::size_t i = j + 1 + row;
+
+            for (std::size_t k = j + 1; k < dim; ++k)
+                coeff(i, k) = divideExact(pivot * coeff(i, k) - coeff(i, j) * coeff(j, k), previousPivot);
+        });
+
+        previousPivot = pivot;
+    }
+
+    return rowSwaps;
+}
+
+void tsym::computeSolution(const SquareMatrixAdaptor<>& coeff, VectorAdaptor<>& rhs, VectorAdaptor<>& x)
+{
+    for (std::size_t i = 0; i < coeff.dim; ++i)
+        for (std::size_t j = 0; j < i; ++j)
+            rhs(i) -= coeff(i, j) * rhs(j);
+
+    substituteBackward(coeff, rhs, x);
+}
+
+void tsym::computeBareissSolution(const SquareMatrixAdaptor<>& coeff, VectorAdaptor<>& rhs, VectorAdaptor<>& x)
+/* The right hand side undergoes the same fraction-free updates as the coefficient matrix during
+ * factorization, with the multipliers stored below and the pivots on the diagonal. */
+{
+    const std::size_t dim = coeff.dim;
+
+    if (dim > 0 && isZeroEntry(coeff(dim - 1, dim - 1)))
+        throw std::invalid_argument("Coefficient matrix is singular");
+
+    for (std::size_t j = 0; j + 1 < dim; ++j) {
+        const Var previousPivot = j == 0 ? Var(1) : coeff(j - 1, j - 1);
+
+        for (std::size_t i = j + 1; i < dim; ++i)
+            rhs(i) = divideExact(coeff(j, j) * rhs(i) - coeff(i, j) * rhs(j), previousPivot);
+    }
+
+    substituteBackward(coeff, rhs, x);
+}
+
+namespace tsym {
+    namespace {
+        std::size_t numericPivot(const SquareMatrixAdaptor<Number>& coeff, std::size_t row)
+        /* The entry with the largest magnitude, no matter whether it is a double or an exact
+         * rational, as this kernel is only used once floating point numbers are involved: */
+        {
+            std::size_t result = row;
+
+            for (std::size_t i = row + 1; i < coeff.dim; ++i)
+                if (abs(coeff(i, row)) > abs(coeff(result, row)))
+                    result = i;
+
+            return result;
+        }
+    }
+}
+
+unsigned tsym::factorizeNumeric(SquareMatrixAdaptor<Number>& coeff, Permutation& permutation)
+{
+    const std::size_t dim = coeff.dim;
+    unsigned rowSwaps = 0;
+
+    permutation = identity(dim);
+
+    for (std::size_t j = 0; j + 1 < dim; ++j) {
+        if (const std::size_t pivIndex = numericPivot(coeff, j); pivIndex != j) {
+            ++rowSwaps;
+            swapRows(coeff, permutation, j, pivIndex);
+        }
+
+        if (coeff(j, j) == 0)
+            /* The matrix is singular, which is detected when solving: */
+            continue;
+
         for (std::size_t i = j + 1; i < dim; ++i) {
-            coeff(i, j) = simplify(coeff(i, j) / coeff(j, j));
+            if (coeff(i, j) == 0)
+                continue;
+
+            coeff(i, j) /= coeff(j, j);
 
             for (std::size_t k = j + 1; k < dim; ++k)
-                coeff(i, k) = simplify(coeff(i, k) - coeff(i, j) * coeff(j, k));
+                coeff(i, k) -= coeff(i, j) * coeff(j, k);
         }
     }
 
     return rowSwaps;
 }
 
-void tsym::computeSolution(SquareMatrixAdaptor<>& coeff, VectorAdaptor<>& rhs, VectorAdaptor<>& x)
+void tsym::computeNumericSolution(
+  const SquareMatrixAdaptor<Number>& coeff, VectorAdaptor<Number>& rhs, VectorAdaptor<Number>& x)
 {
     const std::size_t dim = coeff.dim;
 
-    for (std::size_t i = 0; i < dim; ++i)
-        x(i) = 0;
-
     for (std::size_t i = 0; i < dim; ++i)
         for (std::size_t j = 0; j < i; ++j)
             rhs(i) -= coeff(i, j) * rhs(j);
 
     for (std::size_t i = dim - 1; i + 1 > 0; --i) {
+        x(i) = rhs(i);
+
         for (std::size_t j = i + 1; j < dim; ++j)
             x(i) -= coeff(i, j) * x(j);
 
-        coeff(i, i) = simplify(coeff(i, i));
-
         if (coeff(i, i) == 0)
             throw std::invalid_argument("Coefficient matrix is singular");
 
-        x(i) = simplify((rhs(i) + x(i)) / coeff(i, i));
+        x(i) /= coeff(i, i);
+    }
+}
+
+unsigned tsym::factorizeIntegerBareiss(SquareMatrixAdaptor<Int>& coeff, Permutation& permutation)
+{
+    const std::size_t dim = coeff.dim;
+    unsigned rowSwaps = 0;
+    Int previousPivot(1);
+
+    permutation = identity(dim);
+
+    for (std::size_t j = 0; j + 1 < dim; ++j) {
+        std::size_t pivIndex = j;
+
+        while (pivIndex + 1 < dim && coeff(pivIndex, j) == 0)
+            ++pivIndex;
+
+        if (pivIndex != j) {
+            ++rowSwaps;
+            swapRows(coeff, permutation, j, pivIndex);
+        }
+
+        if (coeff(j, j) == 0) {
+            coeff(dim - 1, dim - 1) = 0;
+            return rowSwaps;
+        }
+
+        for (std::size_t i = j + 1; i < dim; ++i)
+            for (std::size_t k = j + 1; k < dim; ++k)
+                coeff(i, k) = (coeff(j, j) * coeff(i, k) - coeff(i, j) * coeff(j, k)) / previousPivot;
+
+        previousPivot = coeff(j, j);
+    }
+
+    return rowSwaps;
+}
+
+void tsym::computeNumericBareissSolution(
+  const SquareMatrixAdaptor<Number>& coeff, VectorAdaptor<Number>& rhs, VectorAdaptor<Number>& x)
+{
+    const std::size_t dim = coeff.dim;
+
+    if (dim > 0 && coeff(dim - 1, dim - 1) == 0)
+        throw std::invalid_argument("Coefficient matrix is singular");
+
+    for (std::size_t j = 0; j + 1 < dim; ++j) {
+        const Number previousPivot = j == 0 ? Number(1) : coeff(j - 1, j - 1);
+
+        for (std::size_t i = j + 1; i < dim; ++i)
+            rhs(i) = (coeff(j, j) * rhs(i) - coeff(i, j) * rhs(j)) / previousPivot;
+    }
+
+    for (std::size_t i = dim - 1; i + 1 > 0; --i) {
+        x(i) = rhs(i);
+
+        for (std::size_t j = i + 1; j < dim; ++j)
+            x(i) -= coeff(i, j) * x(j);
+
+        x(i) /= coeff(i, i);
     }
 }
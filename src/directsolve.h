@@ -2,17 +2,52 @@
 #define TSYM_DIRECTSOLVE_H
 
 #include <optional>
+#include <vector>
+#include "int.h"
+#include "number.h"
 #include "stdvecwrapper.h"
 
 namespace tsym {
+    bool isZeroEntry(const Var& entry);
+
     std::size_t firstNonZeroPivot(const SquareMatrixAdaptor<>& coeff, std::size_t row);
     std::size_t leastComplexityPivot(const SquareMatrixAdaptor<>& coeff, std::size_t row);
 
     using PivotStrategy = std::size_t (*)(const SquareMatrixAdaptor<>&, std::size_t);
+    /* Row i of a factorized matrix is row permutation[i] of the original one: */
+    using Permutation = std::vector<std::size_t>;
 
-    /* Performs partial pivoting and returns the number of row swaps: */
+    /* Partial pivoting with the multipliers stored below the diagonal, returns the number of row
+     * swaps. Without a simplification threshold, every update is simplified immediately.
+     * Otherwise, updates are kept as they are unless their complexity exceeds the threshold, and
+     * are simplified once they become pivot candidates or part of the pivot row. The rows below
+     * the pivot are updated on up to nThreads threads: */
+    unsigned factorizeGauss(SquareMatrixAdaptor<>& coeff, Permutation& permutation, PivotStrategy piv,
+      std::optional<unsigned> simplificationThreshold = std::nullopt, unsigned nThreads = 1);
+    /* As above, but only permutes the right hand side, if given: */
     unsigned eliminateGauss(SquareMatrixAdaptor<>& coeff, std::optional<VectorAdaptor<>>& rhs, PivotStrategy piv);
-    void computeSolution(SquareMatrixAdaptor<>& coeff, VectorAdaptor<>& rhs, VectorAdaptor<>& x);
+    /* Fraction-free elimination, where each update is divided exactly by the previous pivot. The
+     * multipliers are kept below the diagonal, the expanded pivots on it, and the last diagonal
+     * entry is the determinant (apart from the sign of the row swaps). If the matrix is singular,
+     * elimination stops early and the last diagonal entry is set to zero. Returns the number of row
+     * swaps. As above, the rows below the pivot are updated on up to nThreads threads: */
+    unsigned factorizeBareiss(
+      SquareMatrixAdaptor<>& coeff, Permutation& permutation, PivotStrategy piv, unsigned nThreads = 1);
+
+    /* Both functions expect an already permuted right hand side, which is modified in place: */
+    void computeSolution(const SquareMatrixAdaptor<>& coeff, VectorAdaptor<>& rhs, VectorAdaptor<>& x);
+    void computeBareissSolution(const SquareMatrixAdaptor<>& coeff, VectorAdaptor<>& rhs, VectorAdaptor<>& x);
+
+    /* Counterparts of the functions above for matrices of plain numbers, which avoid creating and
+     * simplifying an expression for every operation. Floating point matrices are factorized by
+     * Gaussian elimination, integer matrices by fraction-free elimination without any gcd
+     * computation: */
+    unsigned factorizeNumeric(SquareMatrixAdaptor<Number>& coeff, Permutation& permutation);
+    unsigned factorizeIntegerBareiss(SquareMatrixAdaptor<Int>& coeff, Permutation& permutation);
+    void computeNumericSolution(
+      const SquareMatrixAdaptor<Number>& coeff, VectorAdaptor<Number>& rhs, VectorAdaptor<Number>& x);
+    void computeNumericBareissSolution(
+      const SquareMatrixAdaptor<Number>& coeff, VectorAdaptor<Number>& rhs, VectorAdaptor<Number>& x);
 }
 
 #endif
@@ -8,11 +8,16 @@
 #include "logarithm.h"
 #include "logging.h"
 #include "namefct.h"
+#include "numeric.h"
+#include "numericeval.h"
 #include "parser.h"
+#include "poly.h"
 #include "power.h"
 #include "printer.h"
 #include "symbolmap.h"
 #include "trigonometric.h"
+#include "truncatedexpansion.h"
+#include "zerotest.h"
 
 namespace tsym {
     namespace {
@@ -107,11 +112,50 @@ tsym::Var tsym::subst(const Var& arg, const Var& from, const Var& to)
     return Var(arg.get()->subst(*from.get(), to.get()));
 }
 
+tsym::Var tsym::subst(const Var& arg, const std::unordered_map<Var, Var>& replacements)
+{
+    BasePtrMap map;
+
+    for (const auto& [from, to] : replacements)
+        map.insert({from.get(), to.get()});
+
+    return Var(arg.get()->subst(map));
+}
+
+std::optional<tsym::Var> tsym::evaluate(const Var& arg, const std::unordered_map<Var, Var>& bindings)
+{
+    NumberBindings numbers;
+
+    for (const auto& [symbol, value] : bindings)
+        if (const auto num = value.get()->numericEval())
+            numbers.insert({symbol.get(), *num});
+
+    if (const auto result = numericEval(*arg.get(), numbers))
+        return Var(Numeric::create(*result));
+    else
+        return std::nullopt;
+}
+
 tsym::Var tsym::expand(const Var& arg)
 {
     return Var(arg.get()->expand());
 }
 
+tsym::Var tsym::expand(const Var& arg, const DegreeBound& bound)
+{
+    ExpansionBound internalBound{{}, bound.degrees, bound.totalDegree};
+
+    for (const auto& symbol : bound.symbols)
+        internalBound.variables.push_back(symbol.get());
+
+    return Var(expandTruncated(arg.get(), internalBound));
+}
+
+tsym::Var tsym::horner(const Var& arg)
+{
+    return Var(poly::horner(arg.get()));
+}
+
 tsym::Var tsym::simplify(const Var& arg)
 /* Currently, only normalization and expansion is tested for the simplest representation. */
 {
@@ -158,6 +202,14 @@ bool tsym::has(const Var& arg, const Var& what)
     return arg.get()->has(*what.get());
 }
 
+bool tsym::isZeroProbably(const Var& arg, double errorBound)
+{
+    if (const auto result = isZeroModular(*arg.get(), errorBound))
+        return *result;
+
+    return simplify(arg) == 0;
+}
+
 bool tsym::isPositive(const Var& arg)
 {
     return arg.get()->isPositive();
@@ -2,17 +2,56 @@
 #include "gcd.h"
 #include <cassert>
 #include <cmath>
+#include <random>
 #include "basefct.h"
 #include "baseptrlistfct.h"
 #include "logging.h"
+#include "modpoly.h"
 #include "numberfct.h"
 #include "numeric.h"
 #include "polyinfo.h"
 #include "power.h"
 #include "product.h"
+#include "sparsepoly.h"
 #include "sum.h"
 #include "undefined.h"
 
+namespace tsym {
+    namespace {
+        /* Number of evaluation points per variable. If the leading coefficient vanishes at all of
+         * them, nothing can be inferred for this variable: */
+        const int maxNumberOfTrials = 3;
+
+        bool hasGcdOfDegreeZero(
+          const ModPoly& u, const ModPoly& v, std::size_t var, int degree, std::minstd_rand& engine)
+        /* All variables but var are replaced by random values. If the image of u still has the degree
+         * of u over the integers, the leading coefficient of the gcd doesn't vanish either, and its
+         * degree in var can only increase by the reduction and evaluation. A constant univariate gcd
+         * is hence a proof that the gcd of u and v doesn't depend on var. */
+        {
+            std::uniform_int_distribution<std::uint64_t> distribution(0, modp::largestPrime - 1);
+
+            for (int i = 0; i < maxNumberOfTrials; ++i) {
+                ModPoly uImage(u);
+                ModPoly vImage(v);
+
+                for (std::size_t j = 0; j < u.nVariables(); ++j)
+                    if (j != var) {
+                        const std::uint64_t value = distribution(engine);
+
+                        uImage = uImage.evaluate(j, value);
+                        vImage = vImage.evaluate(j, value);
+                    }
+
+                if (uImage.degree(var) == degree)
+                    return modp::gcd(uImage, vImage).isConstant();
+            }
+
+            return false;
+        }
+    }
+}
+
 tsym::BasePtr tsym::Gcd::compute(const BasePtr& u, const BasePtr& v) const
 {
     if (poly::isInputValid(*u, *v))
@@ -43,7 +82,7 @@ tsym::BasePtr tsym::Gcd::compute(const BasePtr& u, const BasePtr& v, const BaseP
         result = uExp;
     else if (isNumeric(*uExp) && isNumeric(*vExp))
         result = computeNumerics(uExp, vExp);
-    else if (!haveCommonSymbol(u, v, L))
+    else if (!haveCommonSymbol(u, v, L) || areCoprime(uExp, vExp, L))
         result = integerContent(u, v);
     else
         result = gcdViaAlgo(uExp, vExp, L);
@@ -82,6 +121,31 @@ bool tsym::Gcd::haveCommonSymbol(const BasePtr& u, const BasePtr& v, const BaseP
     return false;
 }
 
+bool tsym::Gcd::areCoprime(const BasePtr& u, const BasePtr& v, const BasePtrList& L) const
+/* Only a positive result is reliable: the gcd of u and v is then the gcd of their integer contents.
+ * A negative result means that u and v are probably not coprime or that the test wasn't applicable,
+ * e.g. due to non-integer coefficients. */
+{
+    const auto uSparse = SparsePoly::fromBase(*u, L);
+    const auto vSparse = uSparse ? SparsePoly::fromBase(*v, L) : std::nullopt;
+    std::minstd_rand engine;
+
+    if (!vSparse || !uSparse->hasIntegerCoefficients() || !vSparse->hasIntegerCoefficients())
+        return false;
+
+    const ModPoly uMod(*uSparse, modp::largestPrime);
+    const ModPoly vMod(*vSparse, modp::largestPrime);
+
+    for (std::size_t i = 0; i < L.size(); ++i) {
+        const int degree = uSparse->degree(i);
+
+        if (degree > 0 && vSparse->degree(i) > 0 && !hasGcdOfDegreeZero(uMod, vMod, i, degree, engine))
+            return false;
+    }
+
+    return true;
+}
+
 tsym::BasePtr tsym::Gcd::gcdViaAlgo(const BasePtr& u, const BasePtr& v, const BasePtrList& L) const
 {
     const BasePtr intContent(integerContent(u, v));
@@ -24,6 +24,7 @@ namespace tsym {
          * - u = 1 or v = 1
          * - u = v
          * - u and v are both Numerics
+         * - u and v are found to be coprime by evaluation at random points modulo a prime
          *
          * Implementations of a gcd algorithm thus don't need to check for those cases. Both u and
          * v are passed as expanded polynomials.
@@ -45,6 +46,7 @@ namespace tsym {
         BasePtr computeNumerics(const BasePtr& u, const BasePtr& v) const;
         Int integerGcd(const Int& u, const Int& v) const;
         bool haveCommonSymbol(const BasePtr& u, const BasePtr& v, const BasePtrList& L) const;
+        bool areCoprime(const BasePtr& u, const BasePtr& v, const BasePtrList& L) const;
         BasePtr gcdViaAlgo(const BasePtr& u, const BasePtr& v, const BasePtrList& L) const;
         BasePtr integerContent(const BasePtr& u, const BasePtr& v) const;
         Number integerContent(const BasePtr& poly) const;
@@ -0,0 +1,155 @@
+
+#include "heuristicgcd.h"
+#include <algorithm>
+#include <optional>
+#include "modulargcd.h"
+#include "numberfct.h"
+#include "sparsepoly.h"
+
+namespace tsym {
+    namespace {
+        /* Number of evaluation points to try, and an upper limit for the bit size of the integers
+         * the polynomials evaluate to. Beyond that, integer gcds become too expensive: */
+        const int maxNumberOfTrials = 6;
+        const unsigned maxBits = 1000;
+
+        HeuristicGcd::Statistics& statisticsRef()
+        {
+            thread_local HeuristicGcd::Statistics statistics{0, 0};
+
+            return statistics;
+        }
+
+        Int maxNorm(const SparsePoly& u)
+        {
+            Int result(0);
+
+            for (const auto& term : u.terms())
+                result = std::max<Int>(result, abs(term.coeff.numerator()));
+
+            return result;
+        }
+
+        unsigned bitSize(const Int& n)
+        {
+            return n == 0 ? 0 : static_cast<unsigned>(boost::multiprecision::msb(abs(n))) + 1;
+        }
+
+        SparsePoly evaluate(const SparsePoly& u, std::size_t var, const Int& xi)
+        {
+            std::vector<SparsePoly::Term> terms;
+
+            for (const auto& term : u.terms()) {
+                SparsePoly::Exponents exponents(term.exponents);
+                const auto exp = static_cast<unsigned>(exponents[var]);
+
+                exponents[var] = 0;
+                terms.push_back({std::move(exponents), term.coeff * Number(pow(xi, exp))});
+            }
+
+            return SparsePoly(u.nVariables(), std::move(terms));
+        }
+
+        SparsePoly symmetricMod(const SparsePoly& u, const Int& xi)
+        {
+            std::vector<SparsePoly::Term> terms;
+
+            for (const auto& term : u.terms()) {
+                Int remainder = term.coeff.numerator() % xi;
+
+                if (remainder < 0)
+                    remainder += xi;
+
+                if (remainder > xi / 2)
+                    remainder -= xi;
+
+                terms.push_back({term.exponents, Number(remainder)});
+            }
+
+            return SparsePoly(u.nVariables(), std::move(terms));
+        }
+
+        SparsePoly interpolate(SparsePoly gamma, std::size_t var, const Int& xi)
+        /* Reconstructs a polynomial in var from its image gamma at var = xi by xi-adic expansion. */
+        {
+            const SparsePoly inverse(gamma.nVariables(), Number(Int(1), xi));
+            SparsePoly result(gamma.nVariables());
+
+            for (int i = 0; !gamma.isZero(); ++i) {
+                const SparsePoly digit = symmetricMod(gamma, xi);
+
+                result += digit.shift(var, i);
+                gamma -= digit;
+                gamma *= inverse;
+            }
+
+            return result;
+        }
+
+        std::optional<SparsePoly> heuristicGcd(const SparsePoly& u, const SparsePoly& v, std::size_t var)
+        /* Variables with index smaller than var have already been evaluated. */
+        {
+            const std::size_t nVariables = u.nVariables();
+
+            while (var < nVariables && u.degree(var) == 0 && v.degree(var) == 0)
+                ++var;
+
+            if (var == nVariables)
+                return SparsePoly(nVariables, Number(gcd(u.constant().numerator(), v.constant().numerator())));
+
+            const Int uContent = u.integerContent();
+            const Int vContent = v.integerContent();
+            const Int c = gcd(uContent, vContent);
+            const SparsePoly U = u * SparsePoly(nVariables, Number(Int(1), uContent));
+            const SparsePoly V = v * SparsePoly(nVariables, Number(Int(1), vContent));
+            const auto maxDegree = static_cast<unsigned>(std::max(U.degree(var), V.degree(var)));
+            Int xi = 2 * std::min(maxNorm(U), maxNorm(V)) + 29;
+
+            for (int i = 0; i < maxNumberOfTrials; ++i, xi = xi * 73794 / 27011) {
+                if (bitSize(xi) * maxDegree > maxBits)
+                    return std::nullopt;
+
+                const auto gamma = heuristicGcd(evaluate(U, var, xi), evaluate(V, var, xi), var + 1);
+
+                if (!gamma)
+                    continue;
+
+                SparsePoly candidate = interpolate(*gamma, var, xi);
+
+                candidate *= Number(Int(1), candidate.integerContent());
+
+                if (divides(candidate, U, var) && divides(candidate, V, var))
+                    return candidate * SparsePoly(nVariables, Number(c));
+            }
+
+            return std::nullopt;
+        }
+    }
+}
+
+tsym::HeuristicGcd::Statistics tsym::HeuristicGcd::statistics()
+{
+    return statisticsRef();
+}
+
+void tsym::HeuristicGcd::resetStatistics()
+{
+    statisticsRef() = {0, 0};
+}
+
+tsym::BasePtr tsym::HeuristicGcd::gcdAlgo(const BasePtr& u, const BasePtr& v, const BasePtrList& L) const
+{
+    static const ModularGcd fallback;
+    const auto uSparse = SparsePoly::fromBase(*u, L);
+    const auto vSparse = uSparse ? SparsePoly::fromBase(*v, L) : std::nullopt;
+
+    if (vSparse && uSparse->hasIntegerCoefficients() && vSparse->hasIntegerCoefficients())
+        if (const auto result = heuristicGcd(*uSparse, *vSparse, 0)) {
+            ++statisticsRef().successes;
+            return result->toBase(L);
+        }
+
+    ++statisticsRef().fallbacks;
+
+    return fallback.compute(u, v, L);
+}
@@ -0,0 +1,30 @@
+#ifndef TSYM_HEURISTICGCD_H
+#define TSYM_HEURISTICGCD_H
+
+#include "gcd.h"
+
+namespace tsym {
+    class HeuristicGcd : public Gcd {
+        /* Heuristic gcd algorithm (GCDHEU), see Geddes, Czapor, Labahn, Algorithms for Computer
+         * Algebra [1992], chapter 7.7. Variables are successively replaced by large integers, and
+         * the gcd of the resulting integers is mapped back onto a polynomial by its xi-adic
+         * expansion. Candidates are verified by trial division. This is very cheap for small or
+         * trivial gcds, which are the majority during normalization of sums. If verification fails
+         * a couple of times or the input has non-integer coefficients, the modular algorithm is
+         * used instead, which itself resorts to the subresultant algorithm for non-integer input. */
+      public:
+        struct Statistics {
+            unsigned successes;
+            unsigned fallbacks;
+        };
+
+        /* Counters are shared by all instances within the calling thread: */
+        static Statistics statistics();
+        static void resetStatistics();
+
+      private:
+        BasePtr gcdAlgo(const BasePtr& u, const BasePtr& v, const BasePtrList& L) const override;
+    };
+}
+
+#endif
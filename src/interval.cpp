@@ -0,0 +1,214 @@
+
+#include "interval.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string_view>
+#include "base.h"
+#include "basefct.h"
+#include "name.h"
+#include "number.h"
+#include "numberfct.h"
+
+namespace tsym {
+    namespace {
+        constexpr double inf = std::numeric_limits<double>::infinity();
+        constexpr Interval realLine{-inf, inf};
+
+        double down(double value, int ulps = 1)
+        /* Rounds downwards by the given number of ulps, NaN (e.g. from inf - inf) becomes -inf. */
+        {
+            for (int i = 0; i < ulps; ++i)
+                value = std::nextafter(value, -inf);
+
+            return std::isnan(value) ? -inf : value;
+        }
+
+        double up(double value, int ulps = 1)
+        {
+            for (int i = 0; i < ulps; ++i)
+                value = std::nextafter(value, inf);
+
+            return std::isnan(value) ? inf : value;
+        }
+
+        Interval widen(double lower, double upper, int ulps)
+        {
+            return {down(lower, ulps), up(upper, ulps)};
+        }
+
+        Interval add(const Interval& lhs, const Interval& rhs)
+        /* Adding zero is exact. Not rounding in this case keeps e.g. the lower bound of a positive
+         * symbol at zero. The same applies to multiplication and powers below. */
+        {
+            const bool isLowerExact = lhs.lower == 0.0 || rhs.lower == 0.0;
+            const bool isUpperExact = lhs.upper == 0.0 || rhs.upper == 0.0;
+            const double lower = lhs.lower + rhs.lower;
+            const double upper = lhs.upper + rhs.upper;
+
+            return {isLowerExact ? lower : down(lower), isUpperExact ? upper : up(upper)};
+        }
+
+        Interval multiply(const Interval& lhs, const Interval& rhs)
+        /* Zero times an infinite bound is zero here, as infinite bounds are never attained. */
+        {
+            Interval result{inf, -inf};
+
+            for (const double x : {lhs.lower, lhs.upper})
+                for (const double y : {rhs.lower, rhs.upper}) {
+                    const bool isExactZero = x == 0.0 || y == 0.0;
+
+                    result.lower = std::min(result.lower, isExactZero ? 0.0 : down(x * y));
+                    result.upper = std::max(result.upper, isExactZero ? 0.0 : up(x * y));
+                }
+
+            return result;
+        }
+
+        bool isExact(double base, double exp)
+        {
+            return base == 0.0 || base == 1.0 || exp == 0.0 || exp == 1.0 || std::isinf(base);
+        }
+
+        double powDown(double base, double exp)
+        /* The accuracy of std::pow isn't specified, but two ulps are sufficient for glibc. */
+        {
+            return isExact(base, exp) ? std::pow(base, exp) : down(std::pow(base, exp), 2);
+        }
+
+        double powUp(double base, double exp)
+        {
+            return isExact(base, exp) ? std::pow(base, exp) : up(std::pow(base, exp), 2);
+        }
+
+        Interval reciprocal(const Interval& interval)
+        {
+            const double lower = std::isinf(interval.upper) ? 0.0 : down(1.0 / interval.upper);
+            const double upper = std::isinf(interval.lower) ? 0.0 : up(1.0 / interval.lower);
+
+            if (interval.lower > 0.0 || interval.upper < 0.0)
+                return {lower, upper};
+            else if (interval.lower == 0.0 && interval.upper > 0.0)
+                return {lower, inf};
+            else if (interval.upper == 0.0 && interval.lower < 0.0)
+                return {-inf, upper};
+            else
+                return realLine;
+        }
+
+        Interval integerPower(const Interval& base, int exp)
+        {
+            if (exp < 0)
+                return reciprocal(integerPower(base, -exp));
+            else if (exp % 2 != 0 || base.lower >= 0.0)
+                return {powDown(base.lower, exp), powUp(base.upper, exp)};
+            else if (base.upper <= 0.0)
+                return {powDown(base.upper, exp), powUp(base.lower, exp)};
+            else
+                return {0.0, std::max(powUp(base.lower, exp), powUp(base.upper, exp))};
+        }
+
+        Interval power(const Interval& base, const Interval& exp)
+        /* For a non-negative base, x^y is monotonic in each argument, so the extrema are attained
+         * at the corners. */
+        {
+            Interval result{inf, -inf};
+
+            if (base.lower < 0.0)
+                return realLine;
+
+            for (const double x : {base.lower, base.upper})
+                for (const double y : {exp.lower, exp.upper}) {
+                    result.lower = std::min(result.lower, powDown(x, y));
+                    result.upper = std::max(result.upper, powUp(x, y));
+                }
+
+            return result;
+        }
+
+        Interval enclosePower(const Base& expr)
+        {
+            const Interval base = enclosure(*expr.base());
+            const auto exp = expr.exp()->numericEval();
+
+            if (exp && isInt(*exp) && abs(*exp) < Number(std::numeric_limits<int>::max()))
+                return integerPower(base, static_cast<int>(exp->numerator()));
+            else
+                return power(base, enclosure(*expr.exp()));
+        }
+
+        template <class Fct> Interval increasing(const Interval& arg, double min, double max, Fct fct)
+        /* Evaluates a monotonically increasing function with domain [min, max]. */
+        {
+            const double lower = std::max(arg.lower, min);
+            const double upper = std::min(arg.upper, max);
+
+            return lower > upper ? realLine : widen(fct(lower), fct(upper), 2);
+        }
+
+        Interval encloseFunction(const Base& expr)
+        {
+            const std::string_view name = expr.name().value;
+            const Interval arg = enclosure(*expr.operands().front());
+            const double pi = M_PI;
+
+            if (name == "sin" || name == "cos")
+                return {-1.0, 1.0};
+            else if (name == "asin")
+                return increasing(arg, -1.0, 1.0, [](double x) { return std::asin(x); });
+            else if (name == "acos") {
+                const Interval negated = increasing(arg, -1.0, 1.0, [](double x) { return -std::acos(x); });
+
+                return {-negated.upper, -negated.lower};
+            } else if (name == "atan")
+                return increasing(arg, -inf, inf, [](double x) { return std::atan(x); });
+            else if (name == "atan2")
+                return widen(-pi, pi, 2);
+            else if (name == "log")
+                return increasing(arg, 0.0, inf, [](double x) { return std::log(x); });
+            else
+                return realLine;
+        }
+    }
+}
+
+tsym::Interval tsym::enclosure(const Base& expr)
+{
+    if (isNumeric(expr) || isConstant(expr)) {
+        /* The conversion of rationals to double can be off by more than one ulp: */
+        const double value = expr.numericEval()->toDouble();
+
+        return widen(value, value, 2);
+    } else if (isSymbol(expr))
+        return expr.isPositive() ? Interval{0.0, inf} : realLine;
+    else if (isSum(expr)) {
+        Interval result{0.0, 0.0};
+
+        for (const auto& summand : expr.operands())
+            result = add(result, enclosure(*summand));
+
+        return result;
+    } else if (isProduct(expr)) {
+        Interval result{1.0, 1.0};
+
+        for (const auto& factor : expr.operands())
+            result = multiply(result, enclosure(*factor));
+
+        return result;
+    } else if (isPower(expr))
+        return enclosePower(expr);
+    else if (isFunction(expr))
+        return encloseFunction(expr);
+
+    return realLine;
+}
+
+int tsym::sign(const Interval& interval)
+{
+    if (interval.lower > 0.0)
+        return 1;
+    else if (interval.upper < 0.0)
+        return -1;
+    else
+        return 0;
+}
@@ -0,0 +1,24 @@
+#ifndef TSYM_INTERVAL_H
+#define TSYM_INTERVAL_H
+
+namespace tsym {
+    class Base;
+}
+
+namespace tsym {
+    struct Interval {
+        /* Closed interval of real numbers, bounds can be infinite. */
+        double lower;
+        double upper;
+    };
+
+    /* Returns an interval that contains every value the expression can take. Positive symbols are
+     * in (0, inf), all other symbols are unbounded. The result is rigorous, i.e., every floating
+     * point operation is rounded outwards by one or more ulps. For expressions that can't be
+     * bounded (including Undefined), the whole real line is returned. */
+    Interval enclosure(const Base& expr);
+    /* Returns 1 or -1 if the interval contains only positive or negative numbers, 0 otherwise: */
+    int sign(const Interval& interval);
+}
+
+#endif
@@ -0,0 +1,131 @@
+
+#include "sparse.h"
+#include <algorithm>
+#include <unordered_map>
+#include "base.h"
+#include "basefct.h"
+#include "baseptr.h"
+#include "functions.h"
+
+namespace tsym {
+    namespace {
+        using ColumnLookup = std::unordered_map<BasePtr, std::size_t>;
+
+        ColumnLookup symbolColumns(const std::vector<Var>& symbols)
+        {
+            ColumnLookup columns;
+
+            for (std::size_t j = 0; j < symbols.size(); ++j)
+                if (isSymbol(*symbols[j].get()))
+                    columns.insert({symbols[j].get(), j});
+
+            return columns;
+        }
+
+        void markDependencies(const BasePtr& ptr, const ColumnLookup& columns, std::vector<bool>& marked)
+        /* Traverses the expression once and marks all columns of symbols encountered as leaves. This is
+         * equivalent to calling has() for every single symbol, but cheaper for many symbols. */
+        {
+            if (isSymbol(*ptr)) {
+                if (const auto lookup = columns.find(ptr); lookup != cend(columns))
+                    marked[lookup->second] = true;
+            } else
+                for (const auto& operand : ptr->operands())
+                    markDependencies(operand, columns, marked);
+        }
+
+        void markNonSymbolDependencies(const Var& function, const std::vector<Var>& symbols, std::vector<bool>& marked)
+        /* Differentiation w.r.t. anything but a Symbol is undefined, but the dependency shall still
+         * show up in the pattern in order to be consistent with a dense diff() call. */
+        {
+            for (std::size_t j = 0; j < symbols.size(); ++j)
+                if (!isSymbol(*symbols[j].get()) && has(function, symbols[j]))
+                    marked[j] = true;
+        }
+    }
+}
+
+tsym::SparsityPattern tsym::jacobianPattern(const std::vector<Var>& functions, const std::vector<Var>& symbols)
+{
+    const ColumnLookup columns = symbolColumns(symbols);
+    std::vector<bool> marked(symbols.size());
+    SparsityPattern pattern;
+
+    pattern.nRows = functions.size();
+    pattern.nColumns = symbols.size();
+    pattern.rowPointers.reserve(functions.size() + 1);
+
+    for (const auto& function : functions) {
+        std::fill(begin(marked), end(marked), false);
+
+        markDependencies(function.get(), columns, marked);
+
+        if (columns.size() != symbols.size())
+            markNonSymbolDependencies(function, symbols, marked);
+
+        for (std::size_t j = 0; j < marked.size(); ++j)
+            if (marked[j])
+                pattern.columnIndices.push_back(j);
+
+        pattern.rowPointers.push_back(pattern.columnIndices.size());
+    }
+
+    return pattern;
+}
+
+tsym::CsrMatrix tsym::jacobian(const std::vector<Var>& functions, const std::vector<Var>& symbols)
+{
+    const SparsityPattern structure = jacobianPattern(functions, symbols);
+    CsrMatrix result;
+
+    result.pattern.nRows = structure.nRows;
+    result.pattern.nColumns = structure.nColumns;
+    result.pattern.rowPointers.reserve(structure.rowPointers.size());
+
+    for (std::size_t i = 0; i < structure.nRows; ++i) {
+        for (std::size_t k = structure.rowPointers[i]; k < structure.rowPointers[i + 1]; ++k) {
+            const std::size_t j = structure.columnIndices[k];
+            Var derivative = diff(functions[i], symbols[j]);
+
+            if (derivative == 0)
+                continue;
+
+            result.pattern.columnIndices.push_back(j);
+            result.values.push_back(std::move(derivative));
+        }
+
+        result.pattern.rowPointers.push_back(result.values.size());
+    }
+
+    return result;
+}
+
+std::vector<std::size_t> tsym::colorColumns(const SparsityPattern& pattern)
+{
+    const std::size_t uncolored = pattern.nColumns;
+    std::vector<std::vector<std::size_t>> rowsOfColumn(pattern.nColumns);
+    std::vector<std::size_t> colors(pattern.nColumns, uncolored);
+    std::vector<std::size_t> forbiddenBy(pattern.nColumns, uncolored);
+
+    for (std::size_t i = 0; i < pattern.nRows; ++i)
+        for (std::size_t k = pattern.rowPointers[i]; k < pattern.rowPointers[i + 1]; ++k)
+            rowsOfColumn[pattern.columnIndices[k]].push_back(i);
+
+    for (std::size_t j = 0; j < pattern.nColumns; ++j) {
+        /* All colors of columns sharing a row with column j are forbidden, which is marked by
+         * storing j at the color index. */
+        for (const std::size_t i : rowsOfColumn[j])
+            for (std::size_t k = pattern.rowPointers[i]; k < pattern.rowPointers[i + 1]; ++k)
+                if (const std::size_t color = colors[pattern.columnIndices[k]]; color != uncolored)
+                    forbiddenBy[color] = j;
+
+        std::size_t color = 0;
+
+        while (forbiddenBy[color] == j)
+            ++color;
+
+        colors[j] = color;
+    }
+
+    return colors;
+}
@@ -117,6 +117,16 @@ tsym::BasePtr tsym::Logarithm::subst(const Base& from, const BasePtr& to) const
         return create(arg->subst(from, to));
 }
 
+tsym::BasePtr tsym::Logarithm::subst(const BasePtrMap& replacements) const
+{
+    if (const auto lookup = replacements.find(clone()); lookup != cend(replacements))
+        return lookup->second;
+    else if (const BasePtr newArg(arg->subst(replacements)); newArg != arg)
+        return create(newArg);
+    else
+        return clone();
+}
+
 bool tsym::Logarithm::isPositive() const
 {
     return checkSign(&Base::isPositive);
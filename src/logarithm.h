@@ -20,6 +20,7 @@ namespace tsym {
         Fraction normal(SymbolMap& map) const override;
         BasePtr diffWrtSymbol(const Base& symbol) const override;
         BasePtr subst(const Base& from, const BasePtr& to) const override;
+        BasePtr subst(const BasePtrMap& replacements) const override;
         bool isPositive() const override;
         bool isNegative() const override;
         unsigned complexity() const override;
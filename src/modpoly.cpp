@@ -0,0 +1,383 @@
+
+#include "modpoly.h"
+#include <algorithm>
+#include <cassert>
+#include "numberfct.h"
+
+namespace tsym {
+    namespace {
+        bool hasLargerExponents(const ModPoly::Term& lhs, const ModPoly::Term& rhs)
+        {
+            return lhs.exponents > rhs.exponents;
+        }
+
+        bool isDivisible(const ModPoly::Exponents& dividend, const ModPoly::Exponents& divisor)
+        {
+            for (std::size_t i = 0; i < dividend.size(); ++i)
+                if (dividend[i] < divisor[i])
+                    return false;
+
+            return true;
+        }
+    }
+}
+
+tsym::ModPoly::ModPoly(std::size_t nVariables, std::uint64_t prime, std::uint64_t constant)
+    : nVars(nVariables)
+    , p(prime)
+{
+    if (constant % p != 0)
+        termList.push_back({Exponents(nVariables, 0), constant % p});
+}
+
+tsym::ModPoly::ModPoly(const SparsePoly& poly, std::uint64_t prime)
+    : nVars(poly.nVariables())
+    , p(prime)
+{
+    for (const auto& term : poly.terms()) {
+        assert(isInt(term.coeff));
+
+        if (const std::uint64_t coeff = modp::reduce(term.coeff.numerator(), p); coeff != 0)
+            termList.push_back({term.exponents, coeff});
+    }
+}
+
+tsym::ModPoly::ModPoly(std::size_t nVariables, std::uint64_t prime, std::vector<Term>&& terms)
+    : nVars(nVariables)
+    , p(prime)
+    , termList(std::move(terms))
+{
+    sortAndCollect();
+}
+
+tsym::ModPoly tsym::ModPoly::variable(std::size_t nVariables, std::uint64_t prime, std::size_t var)
+{
+    Exponents exponents(nVariables, 0);
+
+    exponents[var] = 1;
+
+    return ModPoly(nVariables, prime, {{std::move(exponents), 1}});
+}
+
+tsym::SparsePoly tsym::ModPoly::toSparse() const
+{
+    std::vector<SparsePoly::Term> terms;
+
+    for (const auto& term : termList) {
+        const Int coeff = term.coeff > p / 2 ? Int(term.coeff) - p : Int(term.coeff);
+
+        terms.push_back({term.exponents, Number(coeff)});
+    }
+
+    return SparsePoly(nVars, std::move(terms));
+}
+
+tsym::ModPoly& tsym::ModPoly::operator+=(const ModPoly& rhs)
+{
+    std::vector<Term> result;
+    auto lhsTerm = cbegin(termList);
+    auto rhsTerm = cbegin(rhs.termList);
+
+    assert(nVars == rhs.nVars && p == rhs.p);
+
+    result.reserve(termList.size() + rhs.termList.size());
+
+    while (lhsTerm != cend(termList) && rhsTerm != cend(rhs.termList))
+        if (hasLargerExponents(*lhsTerm, *rhsTerm))
+            result.push_back(*lhsTerm++);
+        else if (hasLargerExponents(*rhsTerm, *lhsTerm))
+            result.push_back(*rhsTerm++);
+        else {
+            if (const std::uint64_t coeff = (lhsTerm->coeff + rhsTerm->coeff) % p; coeff != 0)
+                result.push_back({lhsTerm->exponents, coeff});
+
+            ++lhsTerm;
+            ++rhsTerm;
+        }
+
+    result.insert(cend(result), lhsTerm, cend(termList));
+    result.insert(cend(result), rhsTerm, cend(rhs.termList));
+
+    termList = std::move(result);
+
+    return *this;
+}
+
+tsym::ModPoly& tsym::ModPoly::operator-=(const ModPoly& rhs)
+{
+    return operator+=(-rhs);
+}
+
+tsym::ModPoly& tsym::ModPoly::operator*=(const ModPoly& rhs)
+{
+    std::vector<Term> result;
+
+    assert(nVars == rhs.nVars && p == rhs.p);
+
+    result.reserve(termList.size() * rhs.termList.size());
+
+    for (const auto& lhsTerm : termList)
+        for (const auto& rhsTerm : rhs.termList) {
+            Exponents exponents(lhsTerm.exponents);
+
+            for (std::size_t i = 0; i < nVars; ++i)
+                exponents[i] += rhsTerm.exponents[i];
+
+            result.push_back({std::move(exponents), lhsTerm.coeff * rhsTerm.coeff % p});
+        }
+
+    termList = std::move(result);
+
+    sortAndCollect();
+
+    return *this;
+}
+
+tsym::ModPoly& tsym::ModPoly::operator*=(std::uint64_t factor)
+{
+    if (factor % p == 0)
+        termList.clear();
+
+    for (auto& term : termList)
+        term.coeff = term.coeff * (factor % p) % p;
+
+    return *this;
+}
+
+tsym::ModPoly tsym::ModPoly::operator-() const
+{
+    ModPoly result(*this);
+
+    for (auto& term : result.termList)
+        term.coeff = p - term.coeff;
+
+    return result;
+}
+
+bool tsym::ModPoly::isZero() const
+{
+    return termList.empty();
+}
+
+bool tsym::ModPoly::isConstant() const
+{
+    const auto isZeroExp = [](int exp) { return exp == 0; };
+
+    if (termList.empty())
+        return true;
+
+    const Exponents& exponents = termList.front().exponents;
+
+    return termList.size() == 1 && std::all_of(cbegin(exponents), cend(exponents), isZeroExp);
+}
+
+std::uint64_t tsym::ModPoly::constant() const
+{
+    return termList.empty() ? 0 : termList.front().coeff;
+}
+
+std::size_t tsym::ModPoly::nVariables() const
+{
+    return nVars;
+}
+
+std::uint64_t tsym::ModPoly::prime() const
+{
+    return p;
+}
+
+const std::vector<tsym::ModPoly::Term>& tsym::ModPoly::terms() const
+{
+    return termList;
+}
+
+int tsym::ModPoly::degree(std::size_t var) const
+{
+    int result = 0;
+
+    for (const auto& term : termList)
+        result = std::max(result, term.exponents[var]);
+
+    return result;
+}
+
+const tsym::ModPoly::Exponents& tsym::ModPoly::leadingExponents() const
+{
+    assert(!termList.empty());
+
+    return termList.front().exponents;
+}
+
+std::uint64_t tsym::ModPoly::leadingCoeff() const
+{
+    assert(!termList.empty());
+
+    return termList.front().coeff;
+}
+
+tsym::ModPoly tsym::ModPoly::monic() const
+{
+    ModPoly result(*this);
+
+    if (!termList.empty())
+        result *= modp::inverse(leadingCoeff(), p);
+
+    return result;
+}
+
+tsym::ModPoly tsym::ModPoly::evaluate(std::size_t var, std::uint64_t value) const
+{
+    ModPoly result(*this);
+
+    for (auto& term : result.termList) {
+        term.coeff = term.coeff * modp::pow(value, static_cast<std::uint64_t>(term.exponents[var]), p) % p;
+        term.exponents[var] = 0;
+    }
+
+    result.sortAndCollect();
+
+    return result;
+}
+
+void tsym::ModPoly::sortAndCollect()
+{
+    std::vector<Term> collected;
+
+    std::sort(begin(termList), end(termList), hasLargerExponents);
+
+    for (auto& term : termList)
+        if (!collected.empty() && collected.back().exponents == term.exponents)
+            collected.back().coeff = (collected.back().coeff + term.coeff) % p;
+        else
+            collected.push_back(std::move(term));
+
+    collected.erase(std::remove_if(begin(collected), end(collected), [](const auto& term) { return term.coeff == 0; }),
+      end(collected));
+
+    termList = std::move(collected);
+}
+
+bool tsym::operator==(const ModPoly& lhs, const ModPoly& rhs)
+{
+    const auto equal = [](const auto& lhsTerm, const auto& rhsTerm) {
+        return lhsTerm.exponents == rhsTerm.exponents && lhsTerm.coeff == rhsTerm.coeff;
+    };
+    const auto& lhsTerms = lhs.terms();
+    const auto& rhsTerms = rhs.terms();
+
+    return lhs.nVariables() == rhs.nVariables() && lhs.prime() == rhs.prime()
+      && std::equal(cbegin(lhsTerms), cend(lhsTerms), cbegin(rhsTerms), cend(rhsTerms), equal);
+}
+
+std::uint64_t tsym::modp::reduce(const Int& n, std::uint64_t prime)
+{
+    const Int remainder = n % prime;
+
+    return static_cast<std::uint64_t>(remainder < 0 ? remainder + prime : remainder);
+}
+
+std::uint64_t tsym::modp::inverse(std::uint64_t n, std::uint64_t prime)
+/* By Fermat's little theorem, n^(p - 2) is the inverse of n. */
+{
+    assert(n % prime != 0);
+
+    return pow(n, prime - 2, prime);
+}
+
+std::uint64_t tsym::modp::pow(std::uint64_t base, std::uint64_t exp, std::uint64_t prime)
+{
+    std::uint64_t result = 1;
+
+    for (base %= prime; exp > 0; exp /= 2) {
+        if (exp % 2 == 1)
+            result = result * base % prime;
+
+        base = base * base % prime;
+    }
+
+    return result;
+}
+
+bool tsym::modp::isPrime(std::uint64_t n)
+/* Deterministic Miller-Rabin test, the bases 2, 7 and 61 are sufficient for n < 2^32. */
+{
+    const std::uint64_t bases[] = {2, 7, 61};
+    std::uint64_t d = n - 1;
+    int s = 0;
+
+    assert(n >> 32 == 0);
+
+    for (const std::uint64_t base : bases)
+        if (n == base)
+            return true;
+        else if (n < 2 || n % base == 0)
+            return false;
+
+    for (; d % 2 == 0; ++s)
+        d /= 2;
+
+    for (const std::uint64_t base : bases) {
+        std::uint64_t x = pow(base, d, n);
+
+        if (x == 1)
+            continue;
+
+        for (int r = 1; r < s && x != n - 1; ++r)
+            x = x * x % n;
+
+        if (x != n - 1)
+            return false;
+    }
+
+    return true;
+}
+
+std::uint64_t tsym::modp::previousPrime(std::uint64_t n)
+{
+    assert(n > 2);
+
+    do
+        --n;
+    while (!isPrime(n));
+
+    return n;
+}
+
+std::pair<tsym::ModPoly, tsym::ModPoly> tsym::modp::divide(const ModPoly& u, const ModPoly& v)
+{
+    const std::size_t nVariables = u.nVariables();
+    const std::uint64_t prime = u.prime();
+    const std::uint64_t lCoeffInverse = inverse(v.leadingCoeff(), prime);
+    ModPoly quotient(nVariables, prime);
+    ModPoly remainder(u);
+
+    while (!remainder.isZero() && isDivisible(remainder.leadingExponents(), v.leadingExponents())) {
+        ModPoly::Exponents exponents(remainder.leadingExponents());
+
+        for (std::size_t i = 0; i < nVariables; ++i)
+            exponents[i] -= v.leadingExponents()[i];
+
+        const std::uint64_t coeff = remainder.leadingCoeff() * lCoeffInverse % prime;
+        const ModPoly term(nVariables, prime, {{std::move(exponents), coeff}});
+
+        quotient += term;
+        remainder -= term * v;
+    }
+
+    return {std::move(quotient), std::move(remainder)};
+}
+
+tsym::ModPoly tsym::modp::gcd(const ModPoly& u, const ModPoly& v)
+{
+    ModPoly a(u);
+    ModPoly b(v);
+
+    while (!b.isZero()) {
+        ModPoly remainder = divide(a, b).second;
+
+        a = std::move(b);
+        b = std::move(remainder);
+    }
+
+    return a.monic();
+}
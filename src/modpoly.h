@@ -0,0 +1,92 @@
+#ifndef TSYM_MODPOLY_H
+#define TSYM_MODPOLY_H
+
+#include <boost/operators.hpp>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "int.h"
+#include "sparsepoly.h"
+
+namespace tsym {
+    class ModPoly : private boost::equality_comparable<ModPoly, boost::ring_operators<ModPoly>> {
+        /* Multivariate polynomial with coefficients in the finite field of integers modulo a prime
+         * p < 2^32, such that the product of two coefficients fits into 64 bit. The representation
+         * is the same as the one of SparsePoly, i.e., terms are sorted in descending
+         * lexicographic order of their exponents and there are no zero coefficients. */
+      public:
+        using Exponents = SparsePoly::Exponents;
+
+        struct Term {
+            Exponents exponents;
+            std::uint64_t coeff;
+        };
+
+        ModPoly(std::size_t nVariables, std::uint64_t prime, std::uint64_t constant = 0);
+        /* Coefficients must be smaller than the prime: */
+        ModPoly(std::size_t nVariables, std::uint64_t prime, std::vector<Term>&& terms);
+        /* All coefficients of the given polynomial must be integers: */
+        ModPoly(const SparsePoly& poly, std::uint64_t prime);
+        /* Returns the variable with the given index as a polynomial: */
+        static ModPoly variable(std::size_t nVariables, std::uint64_t prime, std::size_t var);
+
+        /* Coefficients are converted into the symmetric range (-p/2, p/2]: */
+        SparsePoly toSparse() const;
+
+        ModPoly& operator+=(const ModPoly& rhs);
+        ModPoly& operator-=(const ModPoly& rhs);
+        ModPoly& operator*=(const ModPoly& rhs);
+        ModPoly& operator*=(std::uint64_t factor);
+        ModPoly operator-() const;
+
+        bool isZero() const;
+        bool isConstant() const;
+        std::uint64_t constant() const;
+        std::size_t nVariables() const;
+        std::uint64_t prime() const;
+        const std::vector<Term>& terms() const;
+
+        int degree(std::size_t var) const;
+        /* Exponents and coefficient of the first term in lexicographic order, the polynomial must
+         * be non-zero: */
+        const Exponents& leadingExponents() const;
+        std::uint64_t leadingCoeff() const;
+        /* Scales the polynomial such that the leading coefficient (see above) is one: */
+        ModPoly monic() const;
+        /* Substitutes the given value for the variable, whose exponents are zero afterwards: */
+        ModPoly evaluate(std::size_t var, std::uint64_t value) const;
+
+      private:
+        void sortAndCollect();
+
+        std::size_t nVars;
+        std::uint64_t p;
+        std::vector<Term> termList;
+    };
+
+    bool operator==(const ModPoly& lhs, const ModPoly& rhs);
+
+    namespace modp {
+        /* Largest prime below 2^31, such that all coefficient products fit into 64 bit: */
+        inline constexpr std::uint64_t largestPrime = 2147483647;
+
+        std::uint64_t reduce(const Int& n, std::uint64_t prime);
+        std::uint64_t inverse(std::uint64_t n, std::uint64_t prime);
+        std::uint64_t pow(std::uint64_t base, std::uint64_t exp, std::uint64_t prime);
+        /* Valid for numbers below 2^32: */
+        bool isPrime(std::uint64_t n);
+        /* Returns the largest prime below the given number: */
+        std::uint64_t previousPrime(std::uint64_t n);
+
+        /* Division by repeated cancellation of the lexicographic leading term of u. It stops when
+         * this leading term isn't divisible by the one of v. For univariate polynomials, this is
+         * the usual polynomial division, for multivariate ones, a remainder of zero means that v
+         * divides u. First element of the result is the quotient, second the remainder. */
+        std::pair<ModPoly, ModPoly> divide(const ModPoly& u, const ModPoly& v);
+        /* Euclidean algorithm for polynomials in one and the same variable. The result is monic or
+         * zero, if both u and v are zero: */
+        ModPoly gcd(const ModPoly& u, const ModPoly& v);
+    }
+}
+
+#endif
@@ -0,0 +1,300 @@
+
+#include "modulargcd.h"
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include "logging.h"
+#include "modpoly.h"
+#include "numberfct.h"
+#include "sparsepoly.h"
+#include "subresultantgcd.h"
+#include "unipoly.h"
+
+namespace tsym {
+    namespace {
+        using Exponents = ModPoly::Exponents;
+
+        /* Limits the number of images before falling back to the subresultant algorithm. With
+         * primes of this size, coefficients up to 1900 bits can be reconstructed: */
+        const int maxNumberOfPrimes = 64;
+
+        bool haveEqualPrefix(const Exponents& lhs, const Exponents& rhs, std::size_t length)
+        {
+            return std::equal(cbegin(lhs), cbegin(lhs) + static_cast<std::ptrdiff_t>(length), cbegin(rhs));
+        }
+
+        std::vector<ModPoly> coefficients(const ModPoly& u, std::size_t y)
+        /* Splits u into its coefficients in Z_p[y], considering it a polynomial in the variables
+         * with index smaller than y. As y is the least significant of these variables, terms with
+         * identical exponents in all other variables are adjacent, and the first element of the
+         * result is the leading coefficient. */
+        {
+            const std::vector<ModPoly::Term>& terms = u.terms();
+            std::vector<ModPoly> result;
+            std::vector<ModPoly::Term> coeff;
+
+            for (auto term = cbegin(terms); term != cend(terms); ++term) {
+                Exponents exponents(u.nVariables(), 0);
+                const auto next = std::next(term);
+
+                exponents[y] = term->exponents[y];
+                coeff.push_back({std::move(exponents), term->coeff});
+
+                if (next == cend(terms) || !haveEqualPrefix(term->exponents, next->exponents, y)) {
+                    result.emplace_back(u.nVariables(), u.prime(), std::move(coeff));
+                    coeff.clear();
+                }
+            }
+
+            return result;
+        }
+
+        ModPoly content(const ModPoly& u, std::size_t y)
+        {
+            ModPoly result(u.nVariables(), u.prime());
+
+            for (const auto& coeff : coefficients(u, y))
+                result = modp::gcd(result, coeff);
+
+            return result;
+        }
+
+        ModPoly primitivePart(const ModPoly& u, std::size_t y)
+        {
+            return modp::divide(u, content(u, y)).first;
+        }
+
+        Exponents leadingExponents(const ModPoly& u, std::size_t y)
+        /* Leading monomial of u as a polynomial in the variables with index smaller than y. */
+        {
+            Exponents result(u.leadingExponents());
+
+            result[y] = 0;
+
+            return result;
+        }
+
+        bool divides(const ModPoly& divisor, const ModPoly& dividend)
+        {
+            return modp::divide(dividend, divisor).second.isZero();
+        }
+
+        modp::DenseCoeffs toDense(const ModPoly& u)
+        /* Coefficients of u as a polynomial in the first variable only. */
+        {
+            modp::DenseCoeffs result(u.isZero() ? 0 : static_cast<std::size_t>(u.degree(0)) + 1, 0);
+
+            for (const auto& term : u.terms())
+                result[static_cast<std::size_t>(term.exponents.front())] = term.coeff;
+
+            return result;
+        }
+
+        ModPoly fromDense(const modp::DenseCoeffs& u, std::size_t nVariables, std::uint64_t p)
+        {
+            std::vector<ModPoly::Term> terms;
+
+            for (std::size_t i = 0; i < u.size(); ++i)
+                if (u[i] != 0) {
+                    Exponents exponents(nVariables, 0);
+
+                    exponents.front() = static_cast<int>(i);
+                    terms.push_back({std::move(exponents), u[i]});
+                }
+
+            return ModPoly(nVariables, p, std::move(terms));
+        }
+
+        std::optional<ModPoly> gcdModP(const ModPoly& u, const ModPoly& v, std::size_t nActive)
+        /* Gcd of non-zero u and v in Z_p[x_0, ..., x_k] with k = nActive - 1. Images for
+         * x_k = 0, 1, 2, ... are computed recursively and combined by Newton interpolation, see
+         * Geddes, Czapor, Labahn [1992], algorithm 7.2. The result is determined up to a unit. */
+        {
+            if (nActive == 1)
+                return fromDense(modp::gcd(toDense(u), toDense(v), u.prime()), u.nVariables(), u.prime());
+
+            const std::size_t y = nActive - 1;
+            const std::size_t nVariables = u.nVariables();
+            const std::uint64_t p = u.prime();
+            const ModPoly uContent = content(u, y);
+            const ModPoly vContent = content(v, y);
+            const ModPoly c = modp::gcd(uContent, vContent);
+            const ModPoly U = modp::divide(u, uContent).first;
+            const ModPoly V = modp::divide(v, vContent).first;
+            const ModPoly uLeadingCoeff = coefficients(U, y).front();
+            const ModPoly vLeadingCoeff = coefficients(V, y).front();
+            const ModPoly g = modp::gcd(uLeadingCoeff, vLeadingCoeff);
+            const int degreeBound = g.degree(y) + std::min(U.degree(y), V.degree(y));
+            const ModPoly yVar = ModPoly::variable(nVariables, p, y);
+            ModPoly q(nVariables, p, 1);
+            ModPoly h(nVariables, p);
+
+            for (std::uint64_t alpha = 0; alpha < p; ++alpha) {
+                if (uLeadingCoeff.evaluate(y, alpha).isZero() || vLeadingCoeff.evaluate(y, alpha).isZero())
+                    continue;
+
+                const auto image = gcdModP(U.evaluate(y, alpha), V.evaluate(y, alpha), y);
+
+                if (!image)
+                    continue;
+                else if (image->isConstant())
+                    return c;
+
+                ModPoly cAlpha = image->monic();
+
+                cAlpha *= g.evaluate(y, alpha).constant();
+
+                if (!h.isZero() && leadingExponents(h, y) < cAlpha.leadingExponents())
+                    /* Unlucky evaluation point, the image has a common factor too much. */
+                    continue;
+                else if (h.isZero() || cAlpha.leadingExponents() < leadingExponents(h, y)) {
+                    /* All previous evaluation points were unlucky. */
+                    h = ModPoly(nVariables, p);
+                    q = ModPoly(nVariables, p, 1);
+                }
+
+                ModPoly difference = cAlpha - h.evaluate(y, alpha);
+
+                difference *= modp::inverse(q.evaluate(y, alpha).constant(), p);
+
+                const bool isUnchanged = difference.isZero();
+
+                h += difference * q;
+                q *= yVar - ModPoly(nVariables, p, alpha);
+
+                if (!isUnchanged && q.degree(y) <= degreeBound)
+                    continue;
+
+                const ModPoly pp = primitivePart(h, y);
+
+                if (divides(pp, U) && divides(pp, V))
+                    return c * pp;
+                else if (q.degree(y) > degreeBound)
+                    h = ModPoly(nVariables, p);
+            }
+
+            return std::nullopt;
+        }
+
+        SparsePoly primitivePart(const SparsePoly& u)
+        {
+            return u * SparsePoly(u.nVariables(), Number(1, u.integerContent()));
+        }
+
+        Int chineseRemainder(const Int& coeff, const Int& modulus, std::uint64_t image, std::uint64_t prime)
+        /* Returns the integer in the symmetric range of modulus*prime that is congruent to coeff
+         * modulo modulus and to image modulo prime. The coefficient is expected to be in the
+         * symmetric range of the modulus. */
+        {
+            const std::uint64_t inverse = modp::inverse(modp::reduce(modulus, prime), prime);
+            const std::uint64_t factor = (image + prime - modp::reduce(coeff, prime)) % prime * inverse % prime;
+            const Int product = modulus * prime;
+            Int result = coeff + modulus * factor;
+
+            return result > product / 2 ? result - product : result;
+        }
+
+        SparsePoly chineseRemainder(const SparsePoly& h, const Int& modulus, const ModPoly& image)
+        {
+            const std::uint64_t p = image.prime();
+            auto hTerm = cbegin(h.terms());
+            auto imageTerm = cbegin(image.terms());
+            std::vector<SparsePoly::Term> terms;
+
+            while (hTerm != cend(h.terms()) || imageTerm != cend(image.terms())) {
+                const bool hasHTerm = hTerm != cend(h.terms());
+                const bool hasImageTerm = imageTerm != cend(image.terms());
+                const bool takeH = hasHTerm && (!hasImageTerm || !(hTerm->exponents < imageTerm->exponents));
+                const bool takeImage = hasImageTerm && (!hasHTerm || !(imageTerm->exponents < hTerm->exponents));
+                const Int coeff = takeH ? hTerm->coeff.numerator() : Int(0);
+                const std::uint64_t imageCoeff = takeImage ? imageTerm->coeff : 0;
+                const Exponents& exponents = takeH ? hTerm->exponents : imageTerm->exponents;
+
+                terms.push_back({exponents, Number(chineseRemainder(coeff, modulus, imageCoeff, p))});
+
+                hTerm += takeH ? 1 : 0;
+                imageTerm += takeImage ? 1 : 0;
+            }
+
+            /* Zero coefficients are removed by the constructor: */
+            return SparsePoly(h.nVariables(), std::move(terms));
+        }
+
+        std::optional<SparsePoly> gcdOverIntegers(const SparsePoly& u, const SparsePoly& v)
+        /* See Geddes, Czapor, Labahn [1992], algorithm 7.1, using the stabilization of the
+         * reconstructed coefficients followed by trial division as termination criterion. */
+        {
+            const std::size_t nVariables = u.nVariables();
+            const Int c = gcd(u.integerContent(), v.integerContent());
+            const SparsePoly U = primitivePart(u);
+            const SparsePoly V = primitivePart(v);
+            const Int uLeadingCoeff = U.terms().front().coeff.numerator();
+            const Int vLeadingCoeff = V.terms().front().coeff.numerator();
+            const Int g = gcd(uLeadingCoeff, vLeadingCoeff);
+            std::optional<SparsePoly> h;
+            Int modulus;
+            std::uint64_t prime = modp::largestPrime;
+
+            for (int i = 0; i < maxNumberOfPrimes; ++i, prime = modp::previousPrime(prime)) {
+                if (modp::reduce(uLeadingCoeff, prime) == 0 || modp::reduce(vLeadingCoeff, prime) == 0)
+                    continue;
+
+                const auto image = gcdModP(ModPoly(U, prime), ModPoly(V, prime), nVariables);
+
+                if (!image)
+                    continue;
+                else if (image->isConstant())
+                    return SparsePoly(nVariables, Number(c));
+
+                ModPoly cp = image->monic();
+
+                cp *= modp::reduce(g, prime);
+
+                if (h && h->terms().front().exponents < cp.leadingExponents())
+                    continue;
+                else if (!h || cp.leadingExponents() < h->terms().front().exponents) {
+                    h = cp.toSparse();
+                    modulus = prime;
+                    continue;
+                }
+
+                SparsePoly next = chineseRemainder(*h, modulus, cp);
+
+                modulus *= prime;
+
+                if (next == *h) {
+                    const SparsePoly pp = primitivePart(next);
+
+                    if (divides(pp, U, 0) && divides(pp, V, 0))
+                        return pp * SparsePoly(nVariables, Number(c));
+                }
+
+                h = std::move(next);
+            }
+
+            return std::nullopt;
+        }
+    }
+}
+
+tsym::BasePtr tsym::ModularGcd::gcdAlgo(const BasePtr& u, const BasePtr& v, const BasePtrList& L) const
+{
+    static const SubresultantGcd fallback;
+
+    if (L.size() == 1)
+        if (const auto uDense = UniPoly::fromBase(*u, L.front()); uDense && !uDense->isZero())
+            if (const auto vDense = UniPoly::fromBase(*v, L.front()); vDense && !vDense->isZero())
+                if (const auto result = tsym::gcd(*uDense, *vDense))
+                    return result->toBase(L.front());
+
+    const auto uSparse = SparsePoly::fromBase(*u, L);
+    const auto vSparse = uSparse ? SparsePoly::fromBase(*v, L) : std::nullopt;
+
+    if (vSparse && uSparse->hasIntegerCoefficients() && vSparse->hasIntegerCoefficients())
+        if (const auto result = gcdOverIntegers(*uSparse, *vSparse))
+            return result->toBase(L);
+
+    TSYM_DEBUG("Modular gcd not applicable to %S and %S, fall back to subresultant algorithm.", u, v);
+
+    return fallback.compute(u, v, L);
+}
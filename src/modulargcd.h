@@ -0,0 +1,19 @@
+#ifndef TSYM_MODULARGCD_H
+#define TSYM_MODULARGCD_H
+
+#include "gcd.h"
+
+namespace tsym {
+    class ModularGcd : public Gcd {
+        /* Brown's modular gcd algorithm: the gcd is computed modulo several word-size primes by
+         * recursive evaluation and interpolation over all but one variable, down to univariate
+         * Euclidean gcds. The integer coefficients are reconstructed by the Chinese remainder
+         * theorem and the result is verified by trial division. Input with non-integer
+         * coefficients is passed on to the subresultant algorithm. See Geddes, Czapor, Labahn,
+         * Algorithms for Computer Algebra [1992], chapter 7.4. */
+      private:
+        BasePtr gcdAlgo(const BasePtr& u, const BasePtr& v, const BasePtrList& L) const override;
+    };
+}
+
+#endif
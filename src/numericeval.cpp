@@ -0,0 +1,113 @@
+
+#include "numericeval.h"
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+#include "base.h"
+#include "basefct.h"
+#include "name.h"
+
+namespace tsym {
+    namespace {
+        std::optional<Number> evalRecursive(const Base& expr, const NumberBindings& bindings);
+
+        std::optional<Number> evalSymbol(const Base& symbol, const NumberBindings& bindings)
+        {
+            if (const auto lookup = bindings.find(symbol.clone()); lookup != cend(bindings))
+                return lookup->second;
+            else
+                return std::nullopt;
+        }
+
+        template <class Operation>
+        std::optional<Number> accumulate(Number init, const Base& expr, const NumberBindings& bindings)
+        {
+            for (const auto& operand : expr.operands())
+                if (const auto num = evalRecursive(*operand, bindings))
+                    init = Operation{}(init, *num);
+                else
+                    return std::nullopt;
+
+            return init;
+        }
+
+        std::optional<double> evalFunction(std::string_view name, double arg1, double arg2)
+        {
+            if (name == "sin")
+                return std::sin(arg1);
+            else if (name == "cos")
+                return std::cos(arg1);
+            else if (name == "tan")
+                return std::tan(arg1);
+            else if (name == "asin")
+                return std::asin(arg1);
+            else if (name == "acos")
+                return std::acos(arg1);
+            else if (name == "atan")
+                return std::atan(arg1);
+            else if (name == "atan2")
+                return std::atan2(arg1, arg2);
+            else if (name == "log")
+                return std::log(arg1);
+
+            return std::nullopt;
+        }
+
+        std::optional<Number> evalFunction(const Base& fct, const NumberBindings& bindings)
+        {
+            const BasePtrList& args = fct.operands();
+            const auto arg1 = evalRecursive(*args.front(), bindings);
+            const auto arg2 = args.size() > 1 ? evalRecursive(*args.back(), bindings) : Number{0};
+
+            if (!arg1 || !arg2)
+                return std::nullopt;
+
+            /* Out-of-domain arguments are detected by the C library returning NaN or inf: */
+            if (const auto result = evalFunction(fct.name().value, arg1->toDouble(), arg2->toDouble());
+                result && std::isfinite(*result))
+                return *result;
+
+            return std::nullopt;
+        }
+
+        bool isTooLargeExponent(const Number& exp)
+        /* Rational powers are computed with unsigned exponents, which these can't be cast to: */
+        {
+            return exp.isRational()
+              && (!fitsInto<unsigned>(abs(exp.numerator())) || !fitsInto<unsigned>(exp.denominator()));
+        }
+
+        std::optional<Number> evalRecursive(const Base& expr, const NumberBindings& bindings)
+        {
+            if (isNumeric(expr) || isConstant(expr))
+                return expr.numericEval();
+            else if (isSymbol(expr))
+                return evalSymbol(expr, bindings);
+            else if (isSum(expr))
+                return accumulate<std::plus<Number>>(0, expr, bindings);
+            else if (isProduct(expr))
+                return accumulate<std::multiplies<Number>>(1, expr, bindings);
+            else if (isPower(expr)) {
+                const auto base = evalRecursive(*expr.base(), bindings);
+                const auto exp = base ? evalRecursive(*expr.exp(), bindings) : std::nullopt;
+
+                if (base && exp && !isTooLargeExponent(*exp))
+                    return base->toThe(*exp);
+            } else if (isFunction(expr))
+                return evalFunction(expr, bindings);
+
+            return std::nullopt;
+        }
+    }
+}
+
+std::optional<tsym::Number> tsym::numericEval(const Base& expr, const NumberBindings& bindings)
+{
+    try {
+        return evalRecursive(expr, bindings);
+    } catch (const std::overflow_error&) {
+        /* Thrown by Number for zero divisions and illegal powers: */
+        return std::nullopt;
+    }
+}
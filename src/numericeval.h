@@ -0,0 +1,21 @@
+#ifndef TSYM_NUMERICEVAL_H
+#define TSYM_NUMERICEVAL_H
+
+#include <optional>
+#include <unordered_map>
+#include "baseptr.h"
+#include "number.h"
+
+namespace tsym {
+    using NumberBindings = std::unordered_map<BasePtr, Number>;
+
+    /* Evaluates the expression with values for symbols taken from the given bindings. This is
+     * equivalent to substituting all symbols and calling numericEval() on the result, but the tree
+     * is walked directly, i.e., no intermediate expressions are created or simplified. The result
+     * is exact if all leaves are rational and no function or constant is involved. Nothing is
+     * returned if a symbol is unbound, for undefined expressions and if the evaluation fails, e.g.
+     * due to a division by zero or a function argument outside of its domain. */
+    std::optional<Number> numericEval(const Base& expr, const NumberBindings& bindings);
+}
+
+#endif
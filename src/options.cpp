@@ -9,6 +9,20 @@ namespace tsym {
 
             return maxPrimeResolution;
         }
+
+        options::GcdAlgorithm& gcdAlgorithm()
+        {
+            static options::GcdAlgorithm algo = options::GcdAlgorithm::MODULAR;
+
+            return algo;
+        }
+
+        double& zeroTestErrorBound()
+        {
+            static double bound = 1e-12;
+
+            return bound;
+        }
     }
 }
 
@@ -21,3 +35,23 @@ void tsym::options::setMaxPrimeResolution(Int max)
 {
     maxPrimeResolution() = std::move(max);
 }
+
+tsym::options::GcdAlgorithm tsym::options::getGcdAlgorithm()
+{
+    return gcdAlgorithm();
+}
+
+void tsym::options::setGcdAlgorithm(GcdAlgorithm algo)
+{
+    gcdAlgorithm() = algo;
+}
+
+double tsym::options::getZeroTestErrorBound()
+{
+    return zeroTestErrorBound();
+}
+
+void tsym::options::setZeroTestErrorBound(double bound)
+{
+    zeroTestErrorBound() = bound;
+}
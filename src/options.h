@@ -5,8 +5,16 @@
 
 namespace tsym {
     namespace options {
+        enum class GcdAlgorithm { PRIMITIVE, SUBRESULTANT, MODULAR, HEURISTIC };
+
         const Int& getMaxPrimeResolution();
         void setMaxPrimeResolution(Int max);
+        /* Algorithm used for all polynomial gcd computations that don't explicitly pass one: */
+        GcdAlgorithm getGcdAlgorithm();
+        void setGcdAlgorithm(GcdAlgorithm algo);
+        /* Error probability of the zero test used by the linear system solver: */
+        double getZeroTestErrorBound();
+        void setZeroTestErrorBound(double bound);
     }
 }
 
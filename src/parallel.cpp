@@ -0,0 +1,143 @@
+
+#include "parallel.h"
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tsym {
+    namespace {
+        using Task = std::function<void(std::size_t)>;
+
+        struct Job {
+            /* Shared by the calling thread and the workers. A worker that wakes up after the job
+             * is finished only finds the exhausted counter, never the task of a subsequent job: */
+            Job(const Task& task, std::size_t n, unsigned nHelpers)
+                : task(task)
+                , n(n)
+                , nHelpers(nHelpers)
+            {}
+
+            void process()
+            {
+                for (std::size_t i = next++; i < n; i = next++)
+                    try {
+                        task(i);
+                    } catch (...) {
+                        next = n;
+
+                        std::lock_guard<std::mutex> lock(errorMutex);
+
+                        if (!error)
+                            error = std::current_exception();
+                    }
+            }
+
+            const Task& task;
+            const std::size_t n;
+            const unsigned nHelpers;
+            std::atomic<std::size_t> next{0};
+            unsigned nBusy = 0;
+            std::mutex errorMutex;
+            std::exception_ptr error;
+        };
+
+        class WorkerPool {
+          public:
+            void run(std::size_t n, unsigned nThreads, const Task& task)
+            {
+                const auto runSequentially = [n, &task]() {
+                    for (std::size_t i = 0; i < n; ++i)
+                        task(i);
+                };
+
+                if (isRunningTask || nThreads <= 1 || n <= 1)
+                    return runSequentially();
+
+                std::unique_lock<std::mutex> runLock(runMutex, std::try_to_lock);
+
+                if (!runLock)
+                    return runSequentially();
+
+                const auto job = std::make_shared<Job>(task, n, nThreads - 1);
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+
+                    while (workers.size() < job->nHelpers)
+                        workers.emplace_back(&WorkerPool::work, this, workers.size());
+
+                    current = job;
+                    ++generation;
+                }
+
+                wakeUp.notify_all();
+
+                isRunningTask = true;
+                job->process();
+                isRunningTask = false;
+
+                std::unique_lock<std::mutex> lock(mutex);
+
+                done.wait(lock, [&job]() { return job->nBusy == 0; });
+                current.reset();
+                lock.unlock();
+
+                if (job->error)
+                    std::rethrow_exception(job->error);
+            }
+
+          private:
+            void work(std::size_t id)
+            {
+                unsigned seenGeneration = 0;
+                std::unique_lock<std::mutex> lock(mutex);
+
+                isRunningTask = true;
+
+                for (;;) {
+                    wakeUp.wait(lock, [this, &seenGeneration]() { return generation != seenGeneration; });
+                    seenGeneration = generation;
+
+                    const std::shared_ptr<Job> job = current;
+
+                    if (!job || id >= job->nHelpers)
+                        continue;
+
+                    ++job->nBusy;
+                    lock.unlock();
+                    job->process();
+                    lock.lock();
+
+                    if (--job->nBusy == 0)
+                        done.notify_all();
+                }
+            }
+
+            static thread_local bool isRunningTask;
+
+            std::mutex runMutex;
+            std::mutex mutex;
+            std::condition_variable wakeUp;
+            std::condition_variable done;
+            std::vector<std::thread> workers;
+            std::shared_ptr<Job> current;
+            unsigned generation = 0;
+        };
+
+        thread_local bool WorkerPool::isRunningTask = false;
+    }
+}
+
+void tsym::parallelFor(std::size_t n, unsigned nThreads, const std::function<void(std::size_t)>& fct)
+{
+    /* The pool is never destroyed, as its idle workers can't be joined during static destruction
+     * without running into the destructors of their thread-local caches, which deregister
+     * themselves from another static object: */
+    static WorkerPool& pool = *new WorkerPool;
+
+    pool.run(n, nThreads, fct);
+}
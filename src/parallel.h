@@ -0,0 +1,17 @@
+#ifndef TSYM_PARALLEL_H
+#define TSYM_PARALLEL_H
+
+#include <cstddef>
+#include <functional>
+
+namespace tsym {
+    /* Calls fct(i) for all i in [0, n) on up to nThreads threads, the calling one included. The
+     * other threads are taken from a pool that persists between calls, such that their
+     * thread-local caches survive. Indices are handed out one at a time from a shared counter, so
+     * threads that are done with cheap items early continue with the remaining ones. Nested calls
+     * and calls while the pool is busy run sequentially. The first exception thrown by fct is
+     * rethrown after all threads have finished, remaining items are then skipped. */
+    void parallelFor(std::size_t n, unsigned nThreads, const std::function<void(std::size_t)>& fct);
+}
+
+#endif
@@ -1,23 +1,30 @@
 
 #include "poly.h"
 #include <boost/range/adaptors.hpp>
+#include <boost/range/algorithm/count_if.hpp>
 #include <boost/range/algorithm/min_element.hpp>
 #include <boost/range/algorithm/transform.hpp>
 #include <boost/range/numeric.hpp>
 #include <cassert>
+#include <optional>
 #include "basefct.h"
 #include "baseptrlistfct.h"
 #include "cache.h"
+#include "heuristicgcd.h"
 #include "logging.h"
+#include "modulargcd.h"
 #include "numberfct.h"
 #include "numeric.h"
+#include "options.h"
 #include "polyinfo.h"
 #include "power.h"
 #include "primitivegcd.h"
 #include "product.h"
+#include "sparsepoly.h"
 #include "subresultantgcd.h"
 #include "sum.h"
 #include "undefined.h"
+#include "unipoly.h"
 
 namespace tsym {
     namespace {
@@ -69,9 +76,65 @@ namespace tsym {
             return {quotient->expand(), remainder};
         }
 
+        std::optional<BasePtrList> divideDense(const BasePtr& u, const BasePtr& v, const BasePtr& x)
+        /* Returns nothing if u or v aren't dense polynomials in x or if v is zero. */
+        {
+            const auto uDense = UniPoly::fromBase(*u, x);
+            const auto vDense = uDense ? UniPoly::fromBase(*v, x) : std::nullopt;
+
+            if (!vDense || vDense->isZero())
+                return std::nullopt;
+
+            const auto [quotient, remainder] = tsym::divide(*uDense, *vDense);
+
+            return BasePtrList{quotient.toBase(x), remainder.toBase(x)};
+        }
+
+        std::optional<BasePtrList> divideSparse(const BasePtr& u, const BasePtr& v, const BasePtrList& L)
+        /* Returns nothing if u or v contain symbols not in L. */
+        {
+            const auto uSparse = SparsePoly::fromBase(*u, L);
+            const auto vSparse = uSparse ? SparsePoly::fromBase(*v, L) : std::nullopt;
+
+            if (!vSparse)
+                return std::nullopt;
+
+            const auto [quotient, remainder] = tsym::divide(*uSparse, *vSparse, 0);
+
+            return BasePtrList{quotient.toBase(L), remainder.toBase(L)};
+        }
+
+        std::optional<BasePtrList> pseudoDivideSparse(
+          const BasePtr& u, const BasePtr& v, const Base& x, bool computeQuotient)
+        {
+            BasePtrList L(poly::listOfSymbols(*u, *v));
+
+            if (!isSymbol(x) || isZero(*v->expand()))
+                return std::nullopt;
+
+            L.remove_if([&x](const auto& symbol) { return symbol->isEqual(x); });
+            L.push_front(x.clone());
+
+            const auto uSparse = SparsePoly::fromBase(*u, L);
+            const auto vSparse = uSparse ? SparsePoly::fromBase(*v, L) : std::nullopt;
+
+            if (!vSparse)
+                return std::nullopt;
+            else if (!computeQuotient)
+                return BasePtrList{Numeric::zero(), pseudoRemainder(*uSparse, *vSparse, 0).toBase(L)};
+
+            const auto [quotient, remainder] = tsym::pseudoDivide(*uSparse, *vSparse, 0);
+
+            return BasePtrList{quotient.toBase(L), remainder.toBase(L)};
+        }
+
         BasePtrList pseudoDivideImpl(const BasePtr& u, const BasePtr& v, const Base& x, bool computeQuotient)
         {
-            if (poly::isInputValid(*u, *v))
+            if (!poly::isInputValid(*u, *v))
+                ;
+            else if (auto result = pseudoDivideSparse(u, v, x, computeQuotient))
+                return std::move(*result);
+            else
                 return pseudoDivideChecked(u, v, x, computeQuotient);
 
             TSYM_ERROR("Invalid polyn. pseudo-division: %S, %S. Return Undefined quotient/remainder.", u, v);
@@ -154,9 +217,21 @@ namespace tsym {
 
         const Gcd& defaultGcd()
         {
-            static SubresultantGcd algo;
-
-            return algo;
+            static const PrimitiveGcd primitive;
+            static const SubresultantGcd subresultant;
+            static const ModularGcd modular;
+            static const HeuristicGcd heuristic;
+
+            switch (options::getGcdAlgorithm()) {
+                case options::GcdAlgorithm::PRIMITIVE:
+                    return primitive;
+                case options::GcdAlgorithm::SUBRESULTANT:
+                    return subresultant;
+                case options::GcdAlgorithm::HEURISTIC:
+                    return heuristic;
+                default:
+                    return modular;
+            }
         }
 
         BasePtr nonTrivialContent(const Base& expandedPolynomial, const Base& x, const Gcd& algo)
@@ -209,10 +284,68 @@ namespace tsym {
     }
 }
 
+namespace tsym {
+    namespace {
+        std::size_t countTermsWith(const Base& sum, const Base& x)
+        {
+            const auto hasVariable = [&x](const auto& term) { return term->degree(x) != 0; };
+
+            return static_cast<std::size_t>(boost::count_if(sum.operands(), hasVariable));
+        }
+
+        BasePtr selectHornerVariable(const Base& sum, const BasePtrList& symbols)
+        /* Greedy choice: the variable that occurs in most terms, and in case of equal numbers of
+         * terms the one with the highest degree. */
+        {
+            BasePtr selected = symbols.front();
+            std::size_t maxTerms = countTermsWith(sum, *selected);
+
+            for (const auto& symbol : symbols) {
+                const std::size_t nTerms = countTermsWith(sum, *symbol);
+
+                if (nTerms > maxTerms || (nTerms == maxTerms && sum.degree(*symbol) > sum.degree(*selected))) {
+                    selected = symbol;
+                    maxTerms = nTerms;
+                }
+            }
+
+            return selected;
+        }
+
+        BasePtr hornerExpanded(const BasePtr& polynomial, const BasePtrList& symbols)
+        {
+            if (!isSum(*polynomial) || symbols.empty())
+                return polynomial;
+
+            const BasePtr x = selectHornerVariable(*polynomial, symbols);
+            BasePtrList remaining = symbols;
+
+            remaining.remove(x);
+            const int minDegree = poly::minDegree(*polynomial, *x);
+            BasePtr result = Numeric::zero();
+            int lastDegree = polynomial->degree(*x);
+
+            for (int exp = lastDegree; exp >= minDegree; --exp) {
+                const BasePtr coeff = polynomial->coeff(*x, exp);
+
+                if (isZero(*coeff))
+                    continue;
+
+                const BasePtr shifted = Product::create(result, Power::create(x, Numeric::create(lastDegree - exp)));
+
+                result = Sum::create(shifted, hornerExpanded(coeff, remaining));
+                lastDegree = exp;
+            }
+
+            return Product::create(Power::create(x, Numeric::create(minDegree)), result);
+        }
+    }
+}
+
 tsym::BasePtrList tsym::poly::divide(const BasePtr& u, const BasePtr& v)
 {
-    static RegisteredCache<BasePtrList, BasePtrList> cache;
-    static auto& map(cache.map);
+    thread_local RegisteredCache<BasePtrList, BasePtrList> cache;
+    thread_local auto& map(cache.map);
 
     if (const auto lookup = map.find({u, v}); lookup != cend(map))
         return lookup->second;
@@ -237,6 +370,10 @@ tsym::BasePtrList tsym::poly::divide(const BasePtr& u, const BasePtr& v, const B
         return {Numeric::one(), zero};
     else if (isZero(*u))
         return {zero, zero};
+    else if (auto result = L.size() == 1 ? divideDense(u, v, L.front()) : std::nullopt)
+        return std::move(*result);
+    else if (auto result = divideSparse(u, v, L))
+        return std::move(*result);
     else
         return divideNonEmpty(u, v, L);
 }
@@ -267,8 +404,8 @@ int tsym::poly::unit(const Base& polynomial, const Base& x)
 
 tsym::BasePtr tsym::poly::gcd(const BasePtr& u, const BasePtr& v)
 {
-    static RegisteredCache<BasePtrList, BasePtr> cache;
-    static auto& map(cache.map);
+    thread_local RegisteredCache<BasePtrList, BasePtr> cache;
+    thread_local auto& map(cache.map);
     const auto lookup = map.find({u, v});
 
     if (lookup != cend(map))
@@ -316,3 +453,13 @@ int tsym::poly::minDegree(const Base& of, const Base& variable)
 
     return 0;
 }
+
+tsym::BasePtr tsym::poly::horner(const BasePtr& polynomial)
+{
+    if (!isInputValid(*polynomial, *polynomial))
+        return polynomial;
+
+    const BasePtr expanded = polynomial->expand();
+
+    return hornerExpanded(expanded, listOfSymbols(*expanded, *expanded));
+}
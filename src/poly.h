@@ -30,6 +30,10 @@ namespace tsym {
         /* A variation of the degree of a polynomial; returns the minimal degree, e.g. minDegree(a^2
          * + a^3) = 2, while the degree will return 3. Used internally by the content function. */
         int minDegree(const Base& of, const Base& variable);
+        /* Rewrites a polynomial into a nested Horner scheme, e.g. a*x^3 + b*x^2 + x becomes
+         * x*(1 + x*(b + a*x)). Multivariate polynomials are processed recursively, the variable
+         * contained in most terms is factored out first. Invalid input is returned unchanged. */
+        BasePtr horner(const BasePtr& polynomial);
     }
 }
 
@@ -3,6 +3,7 @@
 #include <cassert>
 #include <cmath>
 #include <limits>
+#include <unordered_map>
 #include "basefct.h"
 #include "baseptrlistfct.h"
 #include "basetypestr.h"
@@ -10,11 +11,82 @@
 #include "logging.h"
 #include "numberfct.h"
 #include "numeric.h"
+#include "polyinfo.h"
 #include "powernormal.h"
 #include "powersimpl.h"
 #include "product.h"
 #include "sum.h"
 #include "undefined.h"
+#include "unipoly.h"
+
+namespace tsym {
+    namespace {
+        using CollectedTerms = std::unordered_map<BasePtr, Number>;
+
+        void collect(const BasePtr& term, CollectedTerms& terms)
+        {
+            if (isSum(*term))
+                for (const auto& summand : term->operands())
+                    collect(summand, terms);
+            else
+                terms[term->nonNumericTerm()] += term->numericTerm()->numericEval().value();
+        }
+
+        void addMultinomialTerms(const std::vector<std::vector<BasePtr>>& powers, std::size_t index, unsigned remaining,
+          const Int& coeff, BasePtrList& factors, CollectedTerms& terms)
+        /* Adds all terms with the given number of remaining exponents distributed over the summands
+         * starting at the given index. The coefficient is the product of binomial coefficients for
+         * the exponents chosen so far, i.e., the multinomial coefficient. */
+        {
+            if (index + 1 == powers.size()) {
+                BasePtrList term(factors);
+
+                term.push_back(powers[index][remaining]);
+                term.push_front(Numeric::create(coeff));
+
+                collect(Product::create(term)->expand(), terms);
+                return;
+            }
+
+            Int binomial(1);
+
+            for (unsigned exp = 0; exp <= remaining; ++exp) {
+                factors.push_back(powers[index][exp]);
+                addMultinomialTerms(powers, index + 1, remaining - exp, coeff * binomial, factors, terms);
+                factors.pop_back();
+
+                binomial = binomial * (remaining - exp) / (exp + 1);
+            }
+        }
+
+        BasePtr expandMultinomial(const Base& sum, unsigned exp)
+        /* Direct expansion of (s_1 + ... + s_k)^n as the sum over all e_1 + ... + e_k = n of
+         * n!/(e_1!*...*e_k!)*s_1^e_1*...*s_k^e_k. Terms are collected in a hash map, such that the
+         * resulting sum is created once. */
+        {
+            std::vector<std::vector<BasePtr>> powers;
+            CollectedTerms terms;
+            BasePtrList factors;
+            BasePtrList summands;
+
+            for (const auto& summand : sum.operands()) {
+                /* Powers are built as products, such that they are simplified in the same way as
+                 * in the expansion of the product of all factors: */
+                powers.push_back({Numeric::one()});
+
+                for (unsigned i = 0; i < exp; ++i)
+                    powers.back().push_back(Product::create(powers.back().back(), summand));
+            }
+
+            addMultinomialTerms(powers, 0, exp, 1, factors, terms);
+
+            for (const auto& [term, coeff] : terms)
+                summands.push_back(Product::create(Numeric::create(coeff), term));
+
+            return Sum::create(summands);
+        }
+    }
+}
 
 tsym::Power::Power(const BasePtr& base, const BasePtr& exponent, Base::CtorKey&&)
     : Base(typestring::power, {base, exponent})
@@ -157,14 +229,32 @@ tsym::BasePtr tsym::Power::expandIntegerExponent() const
 }
 
 tsym::BasePtr tsym::Power::expandSumBaseIntExp() const
+/* Univariate polynomial bases are exponentiated as dense polynomials, which is considerably faster
+ * for large exponents than the expansion of the product of all factors. Other bases are expanded by
+ * the multinomial theorem. */
 {
     const Int nExp(expRef->numericEval()->numerator());
+    const BasePtrList symbols(poly::listOfSymbols(*baseRef, *baseRef));
+    const bool fitsUnsigned = fitsInto<unsigned>(abs(nExp));
+    const auto dense = symbols.size() == 1 && fitsUnsigned && poly::isInputValid(*baseRef, *baseRef)
+      ? UniPoly::fromBase(*baseRef, symbols.front())
+      : std::nullopt;
+    const BasePtr expandedBase = dense || !fitsUnsigned ? baseRef : baseRef->expand();
     BasePtrList sums;
-
-    for (Int i(0); i < abs(nExp); ++i)
-        sums.push_back(baseRef);
-
-    auto res = expandAsProduct(sums);
+    BasePtr res;
+
+    if (dense)
+        res = dense->toThe(static_cast<unsigned>(abs(nExp))).toBase(symbols.front());
+    else if (fitsUnsigned && isSum(*expandedBase))
+        res = expandMultinomial(*expandedBase, static_cast<unsigned>(abs(nExp)));
+    else if (fitsUnsigned)
+        res = Power::create(expandedBase, Numeric::create(Int(abs(nExp))))->expand();
+    else {
+        for (Int i(0); i < abs(nExp); ++i)
+            sums.push_back(baseRef);
+
+        res = expandAsProduct(sums);
+    }
 
     if (nExp < 0)
         res = Power::oneOver(res);
@@ -180,6 +270,20 @@ tsym::BasePtr tsym::Power::subst(const Base& from, const BasePtr& to) const
         return create(baseRef->subst(from, to), expRef->subst(from, to));
 }
 
+tsym::BasePtr tsym::Power::subst(const BasePtrMap& replacements) const
+{
+    if (const auto lookup = replacements.find(clone()); lookup != cend(replacements))
+        return lookup->second;
+
+    const BasePtr newBase(baseRef->subst(replacements));
+    const BasePtr newExp(expRef->subst(replacements));
+
+    if (newBase == baseRef && newExp == expRef)
+        return clone();
+    else
+        return create(newBase, newExp);
+}
+
 tsym::BasePtr tsym::Power::coeff(const Base& variable, int exp) const
 {
     if (isEqual(variable))
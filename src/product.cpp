@@ -201,6 +201,18 @@ tsym::BasePtr tsym::Product::subst(const Base& from, const BasePtr& to) const
         return create(subst(ops, from, to));
 }
 
+tsym::BasePtr tsym::Product::subst(const BasePtrMap& replacements) const
+{
+    using tsym::subst;
+
+    if (const auto lookup = replacements.find(clone()); lookup != cend(replacements))
+        return lookup->second;
+    else if (auto substituted = subst(ops, replacements))
+        return create(*substituted);
+    else
+        return clone();
+}
+
 tsym::BasePtr tsym::Product::coeff(const Base& variable, int exp) const
 {
     if (isEqual(variable))
@@ -40,6 +40,7 @@ namespace tsym {
         BasePtr nonConstTerm() const override;
         BasePtr expand() const override;
         BasePtr subst(const Base& from, const BasePtr& to) const override;
+        BasePtr subst(const BasePtrMap& replacements) const override;
         BasePtr coeff(const Base& variable, int exp) const override;
         int degree(const Base& variable) const override;
 
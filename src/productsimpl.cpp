@@ -3,7 +3,11 @@
 #include <boost/functional/hash.hpp>
 #include <boost/range/algorithm/find_if.hpp>
 #include <boost/range/numeric.hpp>
+#include <algorithm>
 #include <cassert>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 #include "basefct.h"
 #include "baseptrlistfct.h"
 #include "cache.h"
@@ -65,12 +69,81 @@ namespace tsym {
         BasePtrList simplPreparedFactors(const BasePtrList& u);
         BasePtrList simplNPreparedFactors(const BasePtrList& u);
 
+        /* Minimal number of non-constant factors for collecting equal bases in one pass: */
+        const long bulkThreshold = 3;
+
+        std::optional<BasePtrList> simplBulk(const BasePtrList& factors)
+        /* Non-constant factors are grouped by their base in a hash map, exponents are added up once
+         * per base and the result is sorted once. Constant factors, i.e. numerics, numeric powers
+         * and constant sums, are left to the recursive simplification, which is cheap for their
+         * usually small number. Nothing is returned if this isn't equivalent to the recursive merge,
+         * e.g. for a^(1/2)*a^(1/2) with a symbol a of unknown sign. */
+        {
+            struct Group {
+                BasePtr first;
+                BasePtr base;
+                BasePtrList exponents;
+            };
+            std::unordered_map<BasePtr, std::size_t> lookup;
+            std::vector<Group> groups;
+            BasePtrList constFactors;
+            std::vector<BasePtr> result;
+
+            for (const auto& factor : factors)
+                if (factor->isConst())
+                    constFactors.push_back(factor);
+                else if (BasePtr base = factor->base(); lookup.count(base) == 0) {
+                    lookup.insert({base, groups.size()});
+                    groups.push_back({factor, std::move(base), {factor->exp()}});
+                } else
+                    groups[lookup[base]].exponents.push_back(factor->exp());
+
+            for (const auto& group : groups) {
+                const BasePtr& base(group.base);
+                const auto& exps(group.exponents);
+
+                if (exps.size() == 1) {
+                    result.push_back(group.first);
+                    continue;
+                } else if (!base->isPositive() && !base->isNegative()
+                  && std::any_of(cbegin(exps), cend(exps), [](const auto& exp) { return isFractionNumeric(*exp); }))
+                    return std::nullopt;
+
+                const BasePtr power(Power::create(base, Sum::create(exps)));
+
+                if (isOne(*power))
+                    continue;
+                else if (isProduct(*power) || power->isConst())
+                    return std::nullopt;
+
+                result.push_back(power);
+            }
+
+            for (const auto& factor : constFactors.empty() ? constFactors : simplNFactors(constFactors))
+                if (isOne(*factor))
+                    continue;
+                else if (lookup.count(factor->base()) != 0)
+                    return std::nullopt;
+                else
+                    result.push_back(factor);
+
+            std::stable_sort(
+              begin(result), end(result), [](const auto& lhs, const auto& rhs) { return doPermute(*rhs, *lhs); });
+
+            return BasePtrList(cbegin(result), cend(result));
+        }
+
         BasePtrList simplifyWithoutCache(const BasePtrList& origFactors)
         {
             BasePtrList factors(origFactors);
 
             prepare(factors);
 
+            if (std::count_if(cbegin(factors), cend(factors), [](const auto& f) { return !f->isConst(); })
+              >= bulkThreshold)
+                if (auto result = simplBulk(factors))
+                    return std::move(*result);
+
             if (factors.size() == 2)
                 return simplTwoFactors(factors);
             else
@@ -103,7 +176,11 @@ namespace tsym {
 
         void contractTrigonometrics(BasePtrList& u)
         {
-            contract(u, &areContractableTrigFctPowers, &contractTrigFctPowers);
+            const auto isTrigPower = [](const auto& factor) { return isContractableTrigFctPower(*factor); };
+
+            /* Avoids the quadratic search for contractable pairs in large products: */
+            if (std::count_if(cbegin(u), cend(u), isTrigPower) >= 2)
+                contract(u, &areContractableTrigFctPowers, &contractTrigFctPowers);
         }
 
         void contract(BasePtrList& u, bool (*check)(const Base& f1, const Base& f2),
@@ -617,9 +694,9 @@ namespace tsym {
 
 tsym::BasePtrList tsym::simplifyProduct(const BasePtrList& factors)
 {
-    static RegisteredCache<CacheKey, BasePtrList, boost::hash<CacheKey>, CacheEqualTo> cache;
+    thread_local RegisteredCache<CacheKey, BasePtrList, boost::hash<CacheKey>, CacheEqualTo> cache;
     static const auto& relevantOption = options::getMaxPrimeResolution();
-    static auto& map(cache.map);
+    thread_local auto& map(cache.map);
     const auto key = std::make_pair(factors, relevantOption);
 
     if (const auto lookup = map.find(key); lookup != cend(map))
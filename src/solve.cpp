@@ -1,13 +1,36 @@
 
 #include "solve.h"
+#include <algorithm>
 #include <cassert>
+#include <optional>
+#include <stdexcept>
+#include "base.h"
+#include "basefct.h"
+#include "blocktriangular.h"
+#include "determinant.h"
 #include "directsolve.h"
 #include "functions.h"
+#include "numeric.h"
+#include "numericeval.h"
+#include "parallel.h"
 #include "stdvecwrapper.h"
 
 namespace tsym {
     namespace {
-        Var detFromPlu(SquareMatrixAdaptor<>& A, unsigned nPivotSwaps)
+        /* Laplace expansion requires 2^n minors, which is prohibitive beyond this dimension: */
+        const std::size_t maxLaplaceDim = 16;
+
+        bool isFractionFree(Algo choice)
+        {
+            return choice != Algo::Gauss && choice != Algo::GaussLCPivot;
+        }
+
+        PivotStrategy selectPivot(Algo choice)
+        {
+            return choice == Algo::Gauss ? &firstNonZeroPivot : &leastComplexityPivot;
+        }
+
+        Var detFromPlu(const SquareMatrixAdaptor<>& A, unsigned nPivotSwaps)
         {
             const std::size_t dim = A.dim;
             Var det(nPivotSwaps % 2 == 0 ? 1 : -1);
@@ -17,67 +40,445 @@ namespace tsym {
 
             return simplify(det);
         }
-    }
 
-    PivotStrategy selectPivot(Algo choice)
-    {
-        return choice == Algo::Gauss ? &firstNonZeroPivot : &leastComplexityPivot;
+        Var detFromBareiss(const SquareMatrixAdaptor<>& A, unsigned nPivotSwaps)
+        {
+            const std::size_t dim = A.dim;
+
+            if (dim == 0)
+                return 1;
+
+            return simplify(nPivotSwaps % 2 == 0 ? A(dim - 1, dim - 1) : -A(dim - 1, dim - 1));
+        }
+
+        std::vector<Var> toRowMajor(const detail::MatrixView& A)
+        {
+            const std::size_t dim = A.dim();
+            std::vector<Var> result;
+
+            result.reserve(dim * dim);
+
+            for (std::size_t i = 0; i < dim; ++i)
+                for (std::size_t j = 0; j < dim; ++j)
+                    result.push_back(A(i, j));
+
+            return result;
+        }
+
+        std::vector<std::vector<Var>> unitColumns(std::size_t dim)
+        {
+            std::vector<std::vector<Var>> result(dim, std::vector<Var>(dim, 0));
+
+            for (std::size_t i = 0; i < dim; ++i)
+                result[i][i] = 1;
+
+            return result;
+        }
+
+        bool isNumber(const Var& entry)
+        {
+            return isNumeric(*entry.get());
+        }
+
+        std::vector<Number> toNumbers(const std::vector<Var>& entries)
+        {
+            std::vector<Number> result;
+
+            result.reserve(entries.size());
+
+            for (const auto& entry : entries)
+                result.push_back(*entry.get()->numericEval());
+
+            return result;
+        }
+
+        bool isRationalNumber(const Var& entry)
+        {
+            return entry.get()->numericEval()->isRational();
+        }
+
+        template <class T> std::vector<Var> toVars(const std::vector<T>& numbers)
+        {
+            std::vector<Var> result;
+
+            result.reserve(numbers.size());
+
+            for (const auto& number : numbers)
+                result.emplace_back(Numeric::create(number));
+
+            return result;
+        }
+
+        std::vector<Int> scaleToIntegers(const std::vector<Var>& A, std::size_t dim, std::vector<Var>& rowScales)
+        /* Each row is multiplied by the least common multiple of its denominators, which is
+         * stored to scale right hand sides and the determinant accordingly. */
+        {
+            const std::vector<Number> numbers = toNumbers(A);
+            std::vector<Int> result;
+
+            result.reserve(numbers.size());
+            rowScales.clear();
+
+            for (std::size_t i = 0; i < dim; ++i) {
+                Int scale(1);
+
+                for (std::size_t j = 0; j < dim; ++j)
+                    scale = lcm(scale, numbers[i * dim + j].denominator());
+
+                for (std::size_t j = 0; j < dim; ++j) {
+                    const Number& entry = numbers[i * dim + j];
+
+                    result.push_back(entry.numerator() * (scale / entry.denominator()));
+                }
+
+                rowScales.emplace_back(Numeric::create(scale));
+            }
+
+            return result;
+        }
+
+        SparsityPattern nonZeroPattern(const std::vector<Var>& A, std::size_t dim)
+        {
+            SparsityPattern pattern;
+
+            pattern.nRows = pattern.nColumns = dim;
+
+            for (std::size_t i = 0; i < dim; ++i) {
+                for (std::size_t j = 0; j < dim; ++j)
+                    if (!isZeroEntry(A[i * dim + j]))
+                        pattern.columnIndices.push_back(j);
+
+                pattern.rowPointers.push_back(pattern.columnIndices.size());
+            }
+
+            return pattern;
+        }
+
+        std::vector<Var> solveBlockwise(const std::vector<Var>& A, const std::vector<Var>& b, std::size_t dim,
+          const BlockTriangularForm& form, const SolveOptions& options)
+        /* Each diagonal block is solved on its own, after the contributions of the unknowns from
+         * preceding blocks have been moved to the right hand side. */
+        {
+            std::vector<Var> x(dim, 0);
+
+            for (const auto& columns : form.blocks) {
+                const std::size_t blockDim = columns.size();
+                std::vector<std::size_t> rows;
+                std::vector<Var> rhs;
+
+                for (const std::size_t j : columns) {
+                    const std::size_t i = form.rowOfColumn[j];
+                    Var entry = b[i];
+
+                    for (std::size_t k = 0; k < dim; ++k)
+                        if (x[k] != 0 && !std::binary_search(cbegin(columns), cend(columns), k))
+                            entry -= A[i * dim + k] * x[k];
+
+                    rows.push_back(i);
+                    rhs.push_back(simplify(entry));
+                }
+
+                const auto access = [&](std::size_t i, std::size_t j) { return A[rows[i] * dim + columns[j]]; };
+                const std::vector<Var> solution = Factorization(access, blockDim, options).solve(rhs);
+
+                for (std::size_t j = 0; j < blockDim; ++j)
+                    x[columns[j]] = solution[j];
+            }
+
+            return x;
+        }
     }
 }
 
-std::vector<tsym::Var> tsym::detail::solve(std::vector<Var>&& A, std::vector<Var>&& b, std::size_t dim, Algo choice)
+tsym::Factorization::Factorization(std::vector<Var>&& A, std::size_t dim, const SolveOptions& options)
+    : opts(options)
 {
-    VectorAdaptor<> result{std::vector<Var>(dim)};
+    factorize(std::move(A), dim);
+}
 
-    if (choice == Algo::Gauss || choice == Algo::GaussLCPivot) {
-        std::optional<VectorAdaptor<>> rhs{{std::move(b)}};
-        SquareMatrixAdaptor<> coeff{std::move(A), dim};
+void tsym::Factorization::factorize(std::vector<Var>&& A, std::size_t dimension)
+{
+    SquareMatrixAdaptor<> coeff{std::move(A), dimension};
 
-        eliminateGauss(coeff, rhs, selectPivot(choice));
-        computeSolution(coeff, *rhs, result);
-    }
+    if (!std::all_of(cbegin(coeff.data), cend(coeff.data), isNumber))
+        kernel = Kernel::Symbolic;
+    else if (std::all_of(cbegin(coeff.data), cend(coeff.data), isRationalNumber))
+        kernel = Kernel::Integer;
+    else
+        kernel = Kernel::Floating;
+
+    if (kernel == Kernel::Integer) {
+        SquareMatrixAdaptor<Int> integerCoeff{scaleToIntegers(coeff.data, dimension, rowScales), dimension};
+
+        nRowSwaps = factorizeIntegerBareiss(integerCoeff, perm);
+        coeff.data = toVars(integerCoeff.data);
+    } else if (kernel == Kernel::Floating) {
+        SquareMatrixAdaptor<Number> numericCoeff{toNumbers(coeff.data), dimension};
 
-    return result.data;
+        nRowSwaps = factorizeNumeric(numericCoeff, perm);
+        coeff.data = toVars(numericCoeff.data);
+    } else if (isFractionFree(opts.algo))
+        nRowSwaps = factorizeBareiss(coeff, perm, selectPivot(opts.algo), opts.nThreads);
+    else
+        nRowSwaps =
+          factorizeGauss(coeff, perm, selectPivot(opts.algo), opts.simplificationThreshold, opts.nThreads);
+
+    n = dimension;
+    lu = std::move(coeff.data);
 }
 
-tsym::Var tsym::detail::determinant(std::vector<Var>&& A, std::size_t dim, Algo choice)
+std::vector<tsym::Var> tsym::Factorization::solve(const std::vector<Var>& rhs) const
 {
-    SquareMatrixAdaptor<> coeff{std::move(A), dim};
-    std::optional<VectorAdaptor<>> fakeRhs;
+    return solve(std::vector<std::vector<Var>>{rhs}).front();
+}
+
+std::vector<std::vector<tsym::Var>> tsym::Factorization::solve(const std::vector<std::vector<Var>>& rhsColumns) const
+{
+    const SquareMatrixAdaptor<> coeff{lu, n};
+    std::optional<SquareMatrixAdaptor<Number>> numericCoeff;
+    std::vector<std::vector<Var>> result(rhsColumns.size());
+
+    if (kernel != Kernel::Symbolic)
+        numericCoeff = SquareMatrixAdaptor<Number>{toNumbers(lu), n};
+
+    /* Columns are solved independently of each other, possibly in parallel: */
+    parallelFor(rhsColumns.size(), opts.nThreads, [&](std::size_t col) {
+        const std::vector<Var>& column = rhsColumns[col];
+        VectorAdaptor<> rhs{std::vector<Var>(n)};
+        VectorAdaptor<> x{std::vector<Var>(n)};
+
+        assert(column.size() == n);
+
+        for (std::size_t i = 0; i < n; ++i)
+            rhs(i) = kernel == Kernel::Integer ? column[perm[i]] * rowScales[perm[i]] : column[perm[i]];
+
+        if (kernel != Kernel::Symbolic && std::all_of(cbegin(rhs.data), cend(rhs.data), isNumber)) {
+            VectorAdaptor<Number> numericRhs{toNumbers(rhs.data)};
+            VectorAdaptor<Number> numericX{std::vector<Number>(n)};
+
+            if (kernel == Kernel::Integer)
+                computeNumericBareissSolution(*numericCoeff, numericRhs, numericX);
+            else
+                computeNumericSolution(*numericCoeff, numericRhs, numericX);
 
-    assert(choice == Algo::Gauss || choice == Algo::GaussLCPivot);
+            x.data = toVars(numericX.data);
+        } else if (kernel == Kernel::Integer || (kernel == Kernel::Symbolic && isFractionFree(opts.algo)))
+            computeBareissSolution(coeff, rhs, x);
+        else
+            computeSolution(coeff, rhs, x);
 
-    const unsigned nRowSwaps = eliminateGauss(coeff, fakeRhs, selectPivot(choice));
+        result[col] = std::move(x.data);
+    });
 
-    return detFromPlu(coeff, nRowSwaps);
+    return result;
 }
 
-void tsym::detail::invert(std::vector<Var>& A, std::size_t dim, Algo choice)
+tsym::Var tsym::Factorization::determinant() const
 {
-    const std::vector<Var> coeffOrig = std::move(A);
-    SquareMatrixAdaptor<> inverseColumns{std::vector<Var>(dim * dim), dim};
+    const SquareMatrixAdaptor<> coeff{lu, n};
+    Var scale(1);
 
-    assert(choice == Algo::Gauss || choice == Algo::GaussLCPivot);
+    for (const auto& rowScale : rowScales)
+        scale *= rowScale;
 
-    for (std::size_t i = 0; i < dim; ++i) {
-        /* The coefficient matrix should only be factorized once, so will be very inefficient. A
-         * better solutions would allow for factorization of coefficient matrices along with a right
-         * hand side matrix of arbitrary column size. */
-        SquareMatrixAdaptor<> coeff{coeffOrig, dim};
-        VectorAdaptor<> column{std::vector<Var>(dim)};
-        std::optional<VectorAdaptor<>> optRhs{{std::vector<Var>(dim)}};
-        VectorAdaptor<>& rhs = optRhs.value();
+    if (kernel == Kernel::Integer)
+        return detFromBareiss(coeff, nRowSwaps) / scale;
+    else if (kernel == Kernel::Symbolic && isFractionFree(opts.algo))
+        return detFromBareiss(coeff, nRowSwaps);
+    else
+        return detFromPlu(coeff, nRowSwaps);
+}
 
-        for (std::size_t j = 0; j < dim; ++j)
-            rhs(j) = i == j ? 1 : 0;
+std::vector<std::vector<tsym::Var>> tsym::Factorization::inverse() const
+{
+    std::vector<std::vector<Var>> inverseColumns = solve(unitColumns(n));
+    std::vector<std::vector<Var>> result(n, std::vector<Var>(n));
 
-        eliminateGauss(coeff, optRhs, selectPivot(choice));
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t j = 0; j < n; ++j)
+            result[i][j] = std::move(inverseColumns[j][i]);
 
-        computeSolution(coeff, rhs, column);
+    return result;
+}
 
-        for (std::size_t r = 0; r < dim; ++r)
-            inverseColumns(r, i) = std::move(column(r));
-    }
+std::size_t tsym::Factorization::dim() const
+{
+    return n;
+}
+
+const std::vector<std::size_t>& tsym::Factorization::permutation() const
+{
+    return perm;
+}
+
+void tsym::ParametricSolver::prepare(std::vector<Var>&& A, std::size_t dimension)
+/* Entries aren't factorized symbolically, as the factors quickly grow into rational functions of
+ * the parameters that are more expensive to evaluate than eliminating the numbers of an instance. */
+{
+    n = dimension;
+    original = std::move(A);
+    compiled.clear();
+    compiled.reserve(original.size());
+
+    for (const auto& entry : original)
+        if (const auto value = evaluate(entry, {}))
+            compiled.push_back(*value);
+        else
+            compiled.push_back(horner(entry));
+}
+
+std::vector<std::vector<tsym::Var>> tsym::ParametricSolver::solve(
+  const std::vector<Var>& rhs, const std::vector<std::vector<Var>>& parameterValues) const
+{
+    std::vector<std::vector<Var>> result(parameterValues.size());
+    std::vector<Var> compiledRhs;
+
+    assert(rhs.size() == n);
+
+    for (const auto& entry : rhs)
+        compiledRhs.push_back(horner(entry));
+
+    parallelFor(parameterValues.size(), opts.nThreads, [&](std::size_t k) {
+        const std::vector<Var>& values = parameterValues[k];
+
+        assert(values.size() == params.size());
+
+        if (auto x = solveNumerically(compiledRhs, values))
+            result[k] = std::move(*x);
+        else
+            result[k] = solveBySubstitution(rhs, values);
+    });
+
+    return result;
+}
+
+std::optional<std::vector<tsym::Var>> tsym::ParametricSolver::solveNumerically(
+  const std::vector<Var>& rhs, const std::vector<Var>& values) const
+/* Nothing is returned if a value or an entry can't be evaluated to a number. */
+{
+    NumberBindings bindings;
+    std::vector<Var> A;
+    std::vector<Var> b;
+
+    for (std::size_t k = 0; k < params.size(); ++k)
+        if (isNumber(values[k]))
+            bindings.insert({params[k].get(), *values[k].get()->numericEval()});
+        else
+            return std::nullopt;
+
+    const auto evaluateInto = [&bindings](const std::vector<Var>& entries, std::vector<Var>& dest) {
+        dest.reserve(entries.size());
+
+        for (const auto& entry : entries)
+            if (isNumber(entry))
+                dest.push_back(entry);
+            else if (const auto value = numericEval(*entry.get(), bindings))
+                dest.emplace_back(Numeric::create(*value));
+            else
+                return false;
+
+        return true;
+    };
+
+    if (!evaluateInto(compiled, A) || !evaluateInto(rhs, b))
+        return std::nullopt;
+
+    return Factorization(std::move(A), n, opts).solve(b);
+}
+
+std::vector<tsym::Var> tsym::ParametricSolver::solveBySubstitution(
+  const std::vector<Var>& rhs, const std::vector<Var>& values) const
+{
+    std::unordered_map<Var, Var> replacements;
+    std::vector<Var> A;
+    std::vector<Var> b;
+
+    for (std::size_t k = 0; k < params.size(); ++k)
+        replacements.insert({params[k], values[k]});
+
+    A.reserve(original.size());
+    b.reserve(n);
+
+    for (const auto& entry : original)
+        A.push_back(subst(entry, replacements));
+
+    for (const auto& entry : rhs)
+        b.push_back(subst(entry, replacements));
+
+    return detail::solve(std::move(A), std::move(b), n, opts);
+}
+
+std::size_t tsym::ParametricSolver::dim() const
+{
+    return n;
+}
+
+std::vector<tsym::Var> tsym::detail::solve(
+  std::vector<Var>&& A, std::vector<Var>&& b, std::size_t dim, const SolveOptions& options)
+/* The system is permuted to block triangular form first, such that entries of decoupled blocks
+ * are never combined during elimination. */
+{
+    const std::optional<BlockTriangularForm> form = blockTriangularForm(nonZeroPattern(A, dim));
+
+    if (!form)
+        throw std::invalid_argument("Coefficient matrix is singular");
+    else if (form->blocks.size() == 1)
+        return Factorization(std::move(A), dim, options).solve(b);
+    else
+        return solveBlockwise(A, b, dim, *form, options);
+}
+
+void tsym::detail::solve(const MatrixView& A, const VectorView& b, const VectorView& x, const SolveOptions& options)
+{
+    const std::size_t dim = A.dim();
+    std::vector<Var> rhs;
+
+    rhs.reserve(dim);
+
+    for (std::size_t i = 0; i < dim; ++i)
+        rhs.push_back(b(i));
+
+    std::vector<Var> solution = solve(toRowMajor(A), std::move(rhs), dim, options);
+
+    for (std::size_t i = 0; i < dim; ++i)
+        x.set(i, std::move(solution[i]));
+}
+
+tsym::Var tsym::detail::determinant(const MatrixView& A, Algo choice)
+/* Matrices of numbers are always factorized by fraction-free elimination on integers or on
+ * floating point numbers, as this is cheaper than any expansion. */
+{
+    const std::size_t dim = A.dim();
+    const bool isDivisionFree = choice == Algo::Berkowitz || choice == Algo::Laplace;
+    std::vector<Var> entries = toRowMajor(A);
+
+    if (!isDivisionFree || std::all_of(cbegin(entries), cend(entries), isNumber))
+        return Factorization(std::move(entries), dim, choice).determinant();
+
+    const SquareMatrixAdaptor<> coeff{std::move(entries), dim};
+
+    return choice == Algo::Laplace && dim <= maxLaplaceDim ? laplaceDeterminant(coeff) : berkowitzDeterminant(coeff);
+}
+
+tsym::Var tsym::detail::characteristicPolynomial(std::vector<Var>&& A, std::size_t dim, const Var& variable)
+{
+    const std::vector<Var> coeffs = characteristicCoefficients({std::move(A), dim});
+    Var result(0);
+
+    for (std::size_t i = 0; i <= dim; ++i)
+        result += coeffs[i] * tsym::pow(variable, static_cast<int>(dim - i));
+
+    return expand(result);
+}
+
+void tsym::detail::invert(const MatrixView& A, const SolveOptions& options)
+/* The coefficient matrix is factorized only once for all columns of the inverse, which are moved
+ * into the caller's matrix one after another. */
+{
+    const std::size_t dim = A.dim();
+    std::vector<std::vector<Var>> inverseColumns = Factorization(toRowMajor(A), dim, options).solve(unitColumns(dim));
 
-    A = std::move(inverseColumns.data);
+    for (std::size_t j = 0; j < dim; ++j)
+        for (std::size_t i = 0; i < dim; ++i)
+            A.set(i, j, std::move(inverseColumns[j][i]));
 }
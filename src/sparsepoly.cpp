@@ -0,0 +1,474 @@
+
+#include "sparsepoly.h"
+#include <algorithm>
+#include <cassert>
+#include "base.h"
+#include "basefct.h"
+#include "numberfct.h"
+#include "numeric.h"
+#include "power.h"
+#include "product.h"
+#include "sum.h"
+
+namespace tsym {
+    namespace {
+        std::optional<SparsePoly> convert(const Base& expr, const BasePtrList& variables);
+
+        std::optional<SparsePoly> convertNumeric(const Base& numeric, std::size_t nVariables)
+        {
+            if (const Number value = *numeric.numericEval(); value.isRational())
+                return SparsePoly(nVariables, value);
+
+            return std::nullopt;
+        }
+
+        std::optional<SparsePoly> convertSymbol(const Base& symbol, const BasePtrList& variables)
+        {
+            const auto isSame = [&symbol](const auto& var) { return symbol.isEqual(*var); };
+            const auto lookup = std::find_if(cbegin(variables), cend(variables), isSame);
+            SparsePoly::Exponents exponents(variables.size(), 0);
+
+            if (lookup == cend(variables))
+                return std::nullopt;
+
+            exponents[static_cast<std::size_t>(std::distance(cbegin(variables), lookup))] = 1;
+
+            return SparsePoly(variables.size(), {{std::move(exponents), 1}});
+        }
+
+        std::optional<SparsePoly> convertSum(const Base& sum, const BasePtrList& variables)
+        {
+            SparsePoly result(variables.size());
+
+            for (const auto& summand : sum.operands())
+                if (const auto converted = convert(*summand, variables))
+                    result += *converted;
+                else
+                    return std::nullopt;
+
+            return result;
+        }
+
+        std::optional<SparsePoly> convertProduct(const Base& product, const BasePtrList& variables)
+        {
+            SparsePoly result(variables.size(), 1);
+
+            for (const auto& factor : product.operands())
+                if (const auto converted = convert(*factor, variables))
+                    result *= *converted;
+                else
+                    return std::nullopt;
+
+            return result;
+        }
+
+        std::optional<SparsePoly> convertPower(const Base& power, const BasePtrList& variables)
+        {
+            const auto exp = power.exp()->numericEval();
+
+            if (!exp || !isInt(*exp) || *exp < 0 || !fitsInto<int>(exp->numerator()))
+                return std::nullopt;
+            else if (const auto base = convert(*power.base(), variables))
+                return base->toThe(static_cast<int>(exp->numerator()));
+
+            return std::nullopt;
+        }
+
+        std::optional<SparsePoly> convert(const Base& expr, const BasePtrList& variables)
+        {
+            if (isNumeric(expr))
+                return convertNumeric(expr, variables.size());
+            else if (isSymbol(expr))
+                return convertSymbol(expr, variables);
+            else if (isSum(expr))
+                return convertSum(expr, variables);
+            else if (isProduct(expr))
+                return convertProduct(expr, variables);
+            else if (isPower(expr))
+                return convertPower(expr, variables);
+
+            return std::nullopt;
+        }
+
+        bool hasLargerExponents(const SparsePoly::Term& lhs, const SparsePoly::Term& rhs)
+        {
+            return lhs.exponents > rhs.exponents;
+        }
+    }
+}
+
+tsym::SparsePoly::SparsePoly(std::size_t nVariables)
+    : nVars(nVariables)
+{}
+
+tsym::SparsePoly::SparsePoly(std::size_t nVariables, const Number& constant)
+    : nVars(nVariables)
+{
+    if (constant != 0)
+        termList.push_back({Exponents(nVariables, 0), constant});
+}
+
+tsym::SparsePoly::SparsePoly(std::size_t nVariables, std::vector<Term>&& terms)
+    : nVars(nVariables)
+    , termList(std::move(terms))
+{
+    sortAndCollect();
+}
+
+std::optional<tsym::SparsePoly> tsym::SparsePoly::fromBase(const Base& polynomial, const BasePtrList& variables)
+{
+    return convert(polynomial, variables);
+}
+
+tsym::BasePtr tsym::SparsePoly::toBase(const BasePtrList& variables) const
+{
+    BasePtrList summands;
+
+    assert(variables.size() == nVars);
+
+    for (const auto& term : termList) {
+        BasePtrList factors{Numeric::create(term.coeff)};
+        auto var = cbegin(variables);
+
+        for (const int exp : term.exponents) {
+            if (exp != 0)
+                factors.push_back(Power::create(*var, Numeric::create(exp)));
+
+            ++var;
+        }
+
+        summands.push_back(Product::create(factors));
+    }
+
+    return summands.empty() ? Numeric::zero() : Sum::create(summands);
+}
+
+tsym::SparsePoly& tsym::SparsePoly::operator+=(const SparsePoly& rhs)
+/* Merges the two sorted term lists. */
+{
+    std::vector<Term> result;
+    auto lhsTerm = cbegin(termList);
+    auto rhsTerm = cbegin(rhs.termList);
+
+    assert(nVars == rhs.nVars);
+
+    result.reserve(termList.size() + rhs.termList.size());
+
+    while (lhsTerm != cend(termList) && rhsTerm != cend(rhs.termList))
+        if (hasLargerExponents(*lhsTerm, *rhsTerm))
+            result.push_back(*lhsTerm++);
+        else if (hasLargerExponents(*rhsTerm, *lhsTerm))
+            result.push_back(*rhsTerm++);
+        else {
+            if (Number coeff = lhsTerm->coeff + rhsTerm->coeff; coeff != 0)
+                result.push_back({lhsTerm->exponents, std::move(coeff)});
+
+            ++lhsTerm;
+            ++rhsTerm;
+        }
+
+    result.insert(cend(result), lhsTerm, cend(termList));
+    result.insert(cend(result), rhsTerm, cend(rhs.termList));
+
+    termList = std::move(result);
+
+    return *this;
+}
+
+tsym::SparsePoly& tsym::SparsePoly::operator-=(const SparsePoly& rhs)
+{
+    return operator+=(-rhs);
+}
+
+tsym::SparsePoly& tsym::SparsePoly::operator*=(const SparsePoly& rhs)
+{
+    std::vector<Term> result;
+
+    assert(nVars == rhs.nVars);
+
+    result.reserve(termList.size() * rhs.termList.size());
+
+    for (const auto& lhsTerm : termList)
+        for (const auto& rhsTerm : rhs.termList) {
+            Exponents exponents(lhsTerm.exponents);
+
+            for (std::size_t i = 0; i < nVars; ++i)
+                exponents[i] += rhsTerm.exponents[i];
+
+            result.push_back({std::move(exponents), lhsTerm.coeff * rhsTerm.coeff});
+        }
+
+    termList = std::move(result);
+
+    sortAndCollect();
+
+    return *this;
+}
+
+tsym::SparsePoly& tsym::SparsePoly::operator*=(const Number& factor)
+{
+    if (factor == 0)
+        termList.clear();
+
+    for (auto& term : termList)
+        term.coeff *= factor;
+
+    return *this;
+}
+
+tsym::SparsePoly tsym::SparsePoly::operator-() const
+{
+    SparsePoly result(*this);
+
+    for (auto& term : result.termList)
+        term.coeff = -term.coeff;
+
+    return result;
+}
+
+bool tsym::SparsePoly::isZero() const
+{
+    return termList.empty();
+}
+
+bool tsym::SparsePoly::isConstant() const
+{
+    const auto isZeroExp = [](int exp) { return exp == 0; };
+
+    if (termList.empty())
+        return true;
+
+    const Exponents& exponents = termList.front().exponents;
+
+    return termList.size() == 1 && std::all_of(cbegin(exponents), cend(exponents), isZeroExp);
+}
+
+tsym::Number tsym::SparsePoly::constant() const
+{
+    return termList.empty() ? Number(0) : termList.front().coeff;
+}
+
+bool tsym::SparsePoly::hasIntegerCoefficients() const
+{
+    return std::all_of(cbegin(termList), cend(termList), [](const auto& term) { return isInt(term.coeff); });
+}
+
+tsym::Int tsym::SparsePoly::integerContent() const
+{
+    Int result(0);
+
+    for (const auto& term : termList)
+        result = gcd(result, isInt(term.coeff) ? abs(term.coeff.numerator()) : Int(1));
+
+    return result;
+}
+
+std::size_t tsym::SparsePoly::nVariables() const
+{
+    return nVars;
+}
+
+const std::vector<tsym::SparsePoly::Term>& tsym::SparsePoly::terms() const
+{
+    return termList;
+}
+
+int tsym::SparsePoly::degree(std::size_t var) const
+{
+    int result = 0;
+
+    for (const auto& term : termList)
+        result = std::max(result, term.exponents[var]);
+
+    return result;
+}
+
+int tsym::SparsePoly::minDegree(std::size_t var) const
+{
+    if (termList.empty())
+        return 0;
+
+    int result = termList.front().exponents[var];
+
+    for (const auto& term : termList)
+        result = std::min(result, term.exponents[var]);
+
+    return result;
+}
+
+tsym::SparsePoly tsym::SparsePoly::coeff(std::size_t var, int exp) const
+/* All selected terms have the same exponent of the given variable, so setting it to zero doesn't
+ * change their order. */
+{
+    SparsePoly result(nVars);
+
+    for (const auto& term : termList)
+        if (term.exponents[var] == exp) {
+            result.termList.push_back(term);
+            result.termList.back().exponents[var] = 0;
+        }
+
+    return result;
+}
+
+tsym::SparsePoly tsym::SparsePoly::leadingCoeff(std::size_t var) const
+{
+    return coeff(var, degree(var));
+}
+
+tsym::SparsePoly tsym::SparsePoly::shift(std::size_t var, int exp) const
+{
+    SparsePoly result(*this);
+
+    for (auto& term : result.termList)
+        term.exponents[var] += exp;
+
+    return result;
+}
+
+tsym::SparsePoly tsym::SparsePoly::toThe(int exp) const
+{
+    SparsePoly result(nVars, 1);
+    SparsePoly power(*this);
+
+    assert(exp >= 0);
+
+    for (; exp > 0; exp /= 2) {
+        if (exp % 2 == 1)
+            result *= power;
+
+        if (exp > 1)
+            power *= power;
+    }
+
+    return result;
+}
+
+void tsym::SparsePoly::sortAndCollect()
+{
+    std::vector<Term> collected;
+
+    std::sort(begin(termList), end(termList), hasLargerExponents);
+
+    for (auto& term : termList)
+        if (!collected.empty() && collected.back().exponents == term.exponents)
+            collected.back().coeff += term.coeff;
+        else
+            collected.push_back(std::move(term));
+
+    collected.erase(std::remove_if(begin(collected), end(collected), [](const auto& term) { return term.coeff == 0; }),
+      end(collected));
+
+    termList = std::move(collected);
+}
+
+bool tsym::operator==(const SparsePoly& lhs, const SparsePoly& rhs)
+{
+    const auto equal = [](const auto& lhsTerm, const auto& rhsTerm) {
+        return lhsTerm.exponents == rhsTerm.exponents && lhsTerm.coeff == rhsTerm.coeff;
+    };
+    const auto& lhsTerms = lhs.terms();
+    const auto& rhsTerms = rhs.terms();
+
+    return lhs.nVariables() == rhs.nVariables()
+      && std::equal(cbegin(lhsTerms), cend(lhsTerms), cbegin(rhsTerms), cend(rhsTerms), equal);
+}
+
+namespace tsym {
+    namespace {
+        std::pair<SparsePoly, SparsePoly> divideNonEmpty(const SparsePoly& u, const SparsePoly& v, std::size_t var)
+        {
+            const SparsePoly lCoeffV = v.leadingCoeff(var);
+            const int n = v.degree(var);
+            SparsePoly quotient(u.nVariables());
+            SparsePoly remainder(u);
+            int m = u.degree(var);
+
+            while (m >= n) {
+                const auto [c, coeffRemainder] = divide(remainder.leadingCoeff(var), lCoeffV, var + 1);
+
+                if (!coeffRemainder.isZero())
+                    break;
+
+                const SparsePoly tmp = c.shift(var, m - n);
+
+                quotient += tmp;
+                remainder -= tmp * v;
+
+                if (remainder.isZero())
+                    break;
+
+                m = remainder.degree(var);
+            }
+
+            return {std::move(quotient), std::move(remainder)};
+        }
+
+        std::pair<SparsePoly, SparsePoly> pseudoDivideImpl(
+          const SparsePoly& u, const SparsePoly& v, std::size_t var, bool computeQuotient)
+        {
+            const SparsePoly lCoeffV = v.leadingCoeff(var);
+            const int n = v.degree(var);
+            SparsePoly quotient(u.nVariables());
+            SparsePoly remainder(u);
+            int m = u.degree(var);
+            int sigma = 0;
+
+            assert(!v.isZero());
+
+            while (m >= n) {
+                const SparsePoly tmp = remainder.coeff(var, m).shift(var, m - n);
+
+                if (computeQuotient)
+                    quotient = lCoeffV * quotient + tmp;
+
+                remainder = lCoeffV * remainder - v * tmp;
+
+                if (remainder.isZero())
+                    break;
+
+                ++sigma;
+                m = remainder.degree(var);
+            }
+
+            const SparsePoly factor = lCoeffV.toThe(std::max(u.degree(var) - n + 1, 0) - sigma);
+
+            return {computeQuotient ? factor * quotient : quotient, factor * remainder};
+        }
+    }
+}
+
+std::pair<tsym::SparsePoly, tsym::SparsePoly> tsym::divide(const SparsePoly& u, const SparsePoly& v, std::size_t var)
+{
+    const std::size_t nVariables = u.nVariables();
+    const SparsePoly zero(nVariables);
+
+    if (v.isZero())
+        return {zero, u};
+    else if (u == v)
+        return {SparsePoly(nVariables, 1), zero};
+    else if (u.isZero())
+        return {zero, zero};
+    else if (var == nVariables) {
+        /* This is the case of an empty variable list in poly::divide. */
+        assert(u.isConstant() && v.isConstant());
+        return {SparsePoly(nVariables, u.constant() / v.constant()), zero};
+    } else
+        return divideNonEmpty(u, v, var);
+}
+
+std::pair<tsym::SparsePoly, tsym::SparsePoly> tsym::pseudoDivide(
+  const SparsePoly& u, const SparsePoly& v, std::size_t var)
+{
+    return pseudoDivideImpl(u, v, var, true);
+}
+
+tsym::SparsePoly tsym::pseudoRemainder(const SparsePoly& u, const SparsePoly& v, std::size_t var)
+{
+    return pseudoDivideImpl(u, v, var, false).second;
+}
+
+bool tsym::divides(const SparsePoly& divisor, const SparsePoly& dividend, std::size_t var)
+{
+    return divide(dividend, divisor, var).second.isZero();
+}
@@ -0,0 +1,85 @@
+#ifndef TSYM_SPARSEPOLY_H
+#define TSYM_SPARSEPOLY_H
+
+#include <boost/operators.hpp>
+#include <optional>
+#include <utility>
+#include <vector>
+#include "baseptr.h"
+#include "baseptrlist.h"
+#include "number.h"
+
+namespace tsym {
+    class SparsePoly : private boost::equality_comparable<SparsePoly, boost::ring_operators<SparsePoly>> {
+        /* Multivariate polynomial with rational coefficients in distributed representation, i.e., a
+         * list of terms with a coefficient and one exponent per variable. The variables themselves
+         * are not stored, all exponent vectors refer to the same list of symbols passed to the
+         * conversion functions. Terms are sorted in descending lexicographic order of their
+         * exponents (the first variable is the most significant one) and coefficients are never
+         * zero. Arithmetic on this type is much cheaper than on expression trees, as no automatic
+         * simplification takes place. */
+      public:
+        using Exponents = std::vector<int>;
+
+        struct Term {
+            Exponents exponents;
+            Number coeff;
+        };
+
+        explicit SparsePoly(std::size_t nVariables);
+        SparsePoly(std::size_t nVariables, const Number& constant);
+        SparsePoly(std::size_t nVariables, std::vector<Term>&& terms);
+
+        /* Returns nothing if the argument isn't a polynomial in the given variables with rational
+         * coefficients. The argument doesn't need to be expanded: */
+        static std::optional<SparsePoly> fromBase(const Base& polynomial, const BasePtrList& variables);
+        BasePtr toBase(const BasePtrList& variables) const;
+
+        SparsePoly& operator+=(const SparsePoly& rhs);
+        SparsePoly& operator-=(const SparsePoly& rhs);
+        SparsePoly& operator*=(const SparsePoly& rhs);
+        SparsePoly& operator*=(const Number& factor);
+        SparsePoly operator-() const;
+
+        bool isZero() const;
+        bool isConstant() const;
+        /* Zero for the zero polynomial, the first coefficient otherwise: */
+        Number constant() const;
+        bool hasIntegerCoefficients() const;
+        /* Positive gcd of all integer coefficients, where non-integer coefficients contribute a
+         * content of one as in Gcd::integerContent. Zero for the zero polynomial: */
+        Int integerContent() const;
+        std::size_t nVariables() const;
+        const std::vector<Term>& terms() const;
+
+        /* The following functions take the index of the variable. The degree of the zero polynomial
+         * is zero, too: */
+        int degree(std::size_t var) const;
+        int minDegree(std::size_t var) const;
+        SparsePoly coeff(std::size_t var, int exp) const;
+        SparsePoly leadingCoeff(std::size_t var) const;
+        /* Multiplication with the variable to the given power: */
+        SparsePoly shift(std::size_t var, int exp) const;
+        SparsePoly toThe(int exp) const;
+
+      private:
+        void sortAndCollect();
+
+        std::size_t nVars;
+        std::vector<Term> termList;
+    };
+
+    bool operator==(const SparsePoly& lhs, const SparsePoly& rhs);
+
+    /* The algorithms below are straight ports of the poly:: functions with the same name. The
+     * variable index denotes the main variable, all variables with smaller index must not be
+     * contained in the arguments. First element of the returned pair is the quotient, second the
+     * remainder. */
+    std::pair<SparsePoly, SparsePoly> divide(const SparsePoly& u, const SparsePoly& v, std::size_t var);
+    std::pair<SparsePoly, SparsePoly> pseudoDivide(const SparsePoly& u, const SparsePoly& v, std::size_t var);
+    SparsePoly pseudoRemainder(const SparsePoly& u, const SparsePoly& v, std::size_t var);
+    /* True if the remainder of the division of dividend by divisor is zero: */
+    bool divides(const SparsePoly& divisor, const SparsePoly& dividend, std::size_t var);
+}
+
+#endif
@@ -0,0 +1,189 @@
+
+#include <cassert>
+#include <limits>
+#include <map>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include "directsolve.h"
+#include "functions.h"
+#include "sparse.h"
+
+namespace tsym {
+    namespace {
+        using SparseRow = std::map<std::size_t, Var>;
+
+        struct Pivot {
+            std::size_t row;
+            std::size_t column;
+        };
+
+        struct ActiveMatrix {
+            /* Rows of the remaining submatrix along with the set of rows that have a non-zero entry
+             * in each column. Rows and columns are removed from the active part once pivoted. */
+            std::vector<SparseRow> rows;
+            std::vector<std::set<std::size_t>> rowsOfColumn;
+        };
+
+        ActiveMatrix toActive(const CsrMatrix& A)
+        {
+            const SparsityPattern& pattern = A.pattern;
+            ActiveMatrix result{std::vector<SparseRow>(pattern.nRows),
+              std::vector<std::set<std::size_t>>(pattern.nColumns)};
+
+            for (std::size_t i = 0; i < pattern.nRows; ++i)
+                for (std::size_t k = pattern.rowPointers[i]; k < pattern.rowPointers[i + 1]; ++k)
+                    if (const std::size_t j = pattern.columnIndices[k]; !isZeroEntry(A.values[k])) {
+                        result.rows[i].insert({j, A.values[k]});
+                        result.rowsOfColumn[j].insert(i);
+                    }
+
+            return result;
+        }
+
+        Pivot selectPivot(const ActiveMatrix& A, const std::vector<bool>& isActiveRow)
+        /* Markowitz criterion: the product of the remaining entries in pivot row and column is an
+         * upper bound of the fill-in created by this pivot. */
+        {
+            auto leastCost = std::numeric_limits<std::size_t>::max();
+            auto leastComplexity = std::numeric_limits<unsigned>::max();
+            std::optional<Pivot> result;
+
+            for (std::size_t i = 0; i < A.rows.size(); ++i) {
+                if (!isActiveRow[i] || A.rows[i].empty())
+                    continue;
+
+                const std::size_t rowCost = A.rows[i].size() - 1;
+
+                for (const auto& [j, entry] : A.rows[i]) {
+                    const std::size_t cost = rowCost * (A.rowsOfColumn[j].size() - 1);
+
+                    if (cost > leastCost)
+                        continue;
+                    else if (const unsigned comp = complexity(entry); cost < leastCost || comp < leastComplexity) {
+                        leastCost = cost;
+                        leastComplexity = comp;
+                        result = Pivot{i, j};
+                    }
+                }
+            }
+
+            if (!result)
+                throw std::invalid_argument("Coefficient matrix is singular");
+
+            return *result;
+        }
+
+        void eliminate(ActiveMatrix& A, std::vector<Var>& rhs, const Pivot& pivot)
+        {
+            const SparseRow& pivotRow = A.rows[pivot.row];
+            const Var& pivotEntry = pivotRow.at(pivot.column);
+            const std::set<std::size_t> rows = std::move(A.rowsOfColumn[pivot.column]);
+
+            for (const auto& [j, entry] : pivotRow)
+                A.rowsOfColumn[j].erase(pivot.row);
+
+            for (const std::size_t i : rows) {
+                if (i == pivot.row)
+                    continue;
+
+                SparseRow& row = A.rows[i];
+                const Var factor = simplify(row.at(pivot.column) / pivotEntry);
+
+                row.erase(pivot.column);
+
+                for (const auto& [j, entry] : pivotRow) {
+                    if (j == pivot.column)
+                        continue;
+
+                    const auto [position, isFillIn] = row.insert({j, 0});
+                    const Var update = position->second - factor * entry;
+
+                    if (isZeroEntry(update)) {
+                        row.erase(position);
+                        A.rowsOfColumn[j].erase(i);
+                    } else {
+                        position->second = simplify(update);
+
+                        if (isFillIn)
+                            A.rowsOfColumn[j].insert(i);
+                    }
+                }
+
+                rhs[i] = simplify(rhs[i] - factor * rhs[pivot.row]);
+            }
+        }
+
+        std::vector<Var> substituteBackward(
+          const ActiveMatrix& A, const std::vector<Var>& rhs, const std::vector<Pivot>& pivots)
+        /* The row of each pivot only contains entries in columns that are pivoted later, so the
+         * unknowns are determined in reverse order of elimination. */
+        {
+            std::vector<Var> x(rhs.size(), 0);
+
+            for (auto pivot = crbegin(pivots); pivot != crend(pivots); ++pivot) {
+                Var sum = rhs[pivot->row];
+
+                for (const auto& [j, entry] : A.rows[pivot->row])
+                    if (j != pivot->column)
+                        sum -= entry * x[j];
+
+                x[pivot->column] = simplify(sum / A.rows[pivot->row].at(pivot->column));
+            }
+
+            return x;
+        }
+    }
+}
+
+tsym::CsrMatrix tsym::fromTriplets(std::size_t nRows, std::size_t nColumns, const std::vector<Triplet>& triplets)
+{
+    std::vector<SparseRow> rows(nRows);
+    CsrMatrix result;
+
+    for (const auto& [i, j, value] : triplets) {
+        assert(i < nRows && j < nColumns);
+
+        rows[i][j] += value;
+    }
+
+    result.pattern.nRows = nRows;
+    result.pattern.nColumns = nColumns;
+    result.pattern.rowPointers.reserve(nRows + 1);
+
+    for (const auto& row : rows) {
+        for (const auto& [j, value] : row)
+            if (value != 0) {
+                result.pattern.columnIndices.push_back(j);
+                result.values.push_back(value);
+            }
+
+        result.pattern.rowPointers.push_back(result.values.size());
+    }
+
+    return result;
+}
+
+std::vector<tsym::Var> tsym::solve(const CsrMatrix& A, const std::vector<Var>& b)
+{
+    const std::size_t dim = b.size();
+    ActiveMatrix active = toActive(A);
+    std::vector<bool> isActiveRow(dim, true);
+    std::vector<Pivot> pivots;
+    std::vector<Var> rhs(b);
+
+    assert(A.pattern.nRows == dim && A.pattern.nColumns == dim);
+
+    pivots.reserve(dim);
+
+    for (std::size_t step = 0; step < dim; ++step) {
+        const Pivot pivot = selectPivot(active, isActiveRow);
+
+        eliminate(active, rhs, pivot);
+
+        isActiveRow[pivot.row] = false;
+        pivots.push_back(pivot);
+    }
+
+    return substituteBackward(active, rhs, pivots);
+}
@@ -3,17 +3,143 @@
 #include "basefct.h"
 #include "baseptrlistfct.h"
 #include "logging.h"
+#include "numberfct.h"
 #include "numeric.h"
 #include "poly.h"
 #include "power.h"
 #include "product.h"
+#include "sparsepoly.h"
+
+namespace tsym {
+    namespace {
+        /* Ports of Gcd::compute, poly::content and the subresultant algorithm to sparse
+         * polynomials. The variable index is the main variable of the current recursion level. */
+        SparsePoly compute(const SparsePoly& u, const SparsePoly& v, std::size_t var);
+
+        bool haveCommonVariable(const SparsePoly& u, const SparsePoly& v, std::size_t var)
+        {
+            for (std::size_t i = var; i < u.nVariables(); ++i)
+                if (u.degree(i) > 0 && v.degree(i) > 0)
+                    return true;
+
+            return false;
+        }
+
+        SparsePoly normalize(const SparsePoly& result, std::size_t var)
+        {
+            SparsePoly lCoeff(result);
+
+            for (std::size_t i = result.nVariables(); i > var; --i)
+                lCoeff = lCoeff.leadingCoeff(i - 1);
+
+            return lCoeff.constant() < 0 ? -result : result;
+        }
+
+        SparsePoly content(const SparsePoly& u, std::size_t var)
+        {
+            SparsePoly result(u.nVariables());
+
+            if (u.isConstant())
+                return SparsePoly(u.nVariables(), abs(u.constant()));
+
+            for (int i = u.minDegree(var); i <= u.degree(var); ++i)
+                result = compute(u.coeff(var, i), result, var + 1);
+
+            return result;
+        }
+
+        SparsePoly subresultant(const SparsePoly& u, const SparsePoly& v, std::size_t var)
+        {
+            const SparsePoly uContent = content(u, var);
+            const SparsePoly vContent = content(v, var);
+            const SparsePoly d = compute(uContent, vContent, var + 1);
+            SparsePoly U = divide(u, uContent, var).first;
+            SparsePoly V = divide(v, vContent, var).first;
+            const SparsePoly g = compute(U.leadingCoeff(var), V.leadingCoeff(var), var + 1);
+            int delta = U.degree(var) - V.degree(var) + 1;
+            SparsePoly beta(u.nVariables(), delta % 2 == 0 ? 1 : -1);
+            SparsePoly psi(u.nVariables(), -1);
+            int i = 0;
+
+            while (true) {
+                const SparsePoly remainder = pseudoRemainder(U, V, var);
+
+                if (remainder.isZero()) {
+                    U = V;
+                    break;
+                }
+
+                if (++i > 1) {
+                    const int deltaP = delta;
+                    const SparsePoly tmp = -U.leadingCoeff(var);
+                    const SparsePoly num = tmp.toThe(deltaP - 1);
+
+                    delta = U.degree(var) - V.degree(var) + 1;
+                    /* A negative exponent deltaP - 2 turns the division into a multiplication: */
+                    psi = deltaP >= 2 ? divide(num, psi.toThe(deltaP - 2), var + 1).first : num * psi;
+                    beta = tmp * psi.toThe(delta - 1);
+                }
+
+                U = V;
+                V = divide(remainder, beta, var).first;
+            }
+
+            SparsePoly tmp = divide(U.leadingCoeff(var), g, var + 1).first;
+            tmp = divide(U, tmp, var).first;
+            tmp = divide(tmp, content(tmp, var), var).first;
+
+            return d * tmp;
+        }
+
+        SparsePoly gcdAlgo(const SparsePoly& u, const SparsePoly& v, std::size_t var)
+        {
+            return u.degree(var) < v.degree(var) ? subresultant(v, u, var) : subresultant(u, v, var);
+        }
+
+        SparsePoly compute(const SparsePoly& u, const SparsePoly& v, std::size_t var)
+        {
+            const std::size_t nVariables = u.nVariables();
+            const SparsePoly one(nVariables, 1);
+            SparsePoly result(one);
+
+            if (u == one || v == one)
+                ;
+            else if (u.isZero())
+                result = v;
+            else if (v.isZero() || u == v)
+                result = u;
+            else if (u.isConstant() && v.isConstant()) {
+                const Number numU = u.constant();
+                const Number numV = v.constant();
+
+                if (isInt(numU) && isInt(numV))
+                    result = SparsePoly(nVariables, Number(gcd(numU.numerator(), numV.numerator())));
+            } else if (!haveCommonVariable(u, v, var))
+                result = SparsePoly(nVariables, Number(gcd(u.integerContent(), v.integerContent())));
+            else {
+                const Number intContent(gcd(u.integerContent(), v.integerContent()));
+                const Number factor = 1 / intContent;
+
+                result = gcdAlgo(u * SparsePoly(nVariables, factor), v * SparsePoly(nVariables, factor), var);
+                result *= intContent;
+            }
+
+            return normalize(result, var);
+        }
+    }
+}
 
 tsym::BasePtr tsym::SubresultantGcd::gcdAlgo(const BasePtr& u, const BasePtr& v, const BasePtrList& L) const
-/* See Cohen [2003], pages 255 - 256. */
+/* See Cohen [2003], pages 255 - 256. The computation is carried out on sparse polynomials if
+ * possible, falling back to expression trees otherwise. */
 {
     const BasePtr& x(L.front());
+    const auto uSparse = SparsePoly::fromBase(*u, L);
+    const auto vSparse = uSparse ? SparsePoly::fromBase(*v, L) : std::nullopt;
 
-    if (u->degree(*x) < v->degree(*x))
+    if (vSparse)
+        return tsym::gcdAlgo(*uSparse, *vSparse, 0).toBase(L);
+    else if (u->degree(*x) < v->degree(*x))
         return gcd(v, u, L);
     else
         return gcd(u, v, L);
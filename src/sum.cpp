@@ -7,6 +7,7 @@
 #include "baseptrlistfct.h"
 #include "basetypestr.h"
 #include "fraction.h"
+#include "interval.h"
 #include "numberfct.h"
 #include "numeric.h"
 #include "poly.h"
@@ -141,14 +142,16 @@ int tsym::Sum::sign() const
     const int numericSign = signOfNumericParts();
     const int sumOfSigns = numericSign + signOfSymbolicParts();
 
-    if (numericSign == 0)
+    if (numericSign == 0 && sumOfSigns != 0)
         return sumOfSigns;
     else if (sumOfSigns > 1)
         return 1;
     else if (sumOfSigns < -1)
         return -1;
     else
-        return 0;
+        /* The summands have different or unknown signs, e.g. 2 - sin(a). An interval enclosure
+         * can still decide this without any expensive simplification. */
+        return tsym::sign(enclosure(*this));
 }
 
 int tsym::Sum::signOfNumericParts() const
@@ -200,6 +203,18 @@ tsym::BasePtr tsym::Sum::subst(const tsym::Base& from, const tsym::BasePtr& to)
         return create(subst(ops, from, to));
 }
 
+tsym::BasePtr tsym::Sum::subst(const BasePtrMap& replacements) const
+{
+    using tsym::subst;
+
+    if (const auto lookup = replacements.find(clone()); lookup != cend(replacements))
+        return lookup->second;
+    else if (auto substituted = subst(ops, replacements))
+        return create(*substituted);
+    else
+        return clone();
+}
+
 tsym::BasePtr tsym::Sum::coeff(const Base& variable, int exp) const
 {
     if (isEqual(variable))
@@ -1,6 +1,9 @@
 
 #include "sumsimpl.h"
+#include <algorithm>
 #include <cassert>
+#include <unordered_map>
+#include <vector>
 #include "basefct.h"
 #include "baseptrlistfct.h"
 #include "cache.h"
@@ -30,8 +33,94 @@ namespace tsym {
         bool haveEqualFirstOperands(const BasePtr& pow1, const BasePtr& pow2);
         BasePtrList simplNSummands(const BasePtrList& u);
 
+        /* Minimal number of summands for collecting like terms in one pass: */
+        const std::size_t bulkThreshold = 4;
+
+        BasePtrList flatten(const BasePtrList& summands)
+        {
+            BasePtrList result;
+
+            for (const auto& summand : summands)
+                if (isSum(*summand))
+                    result.insert(cend(result), cbegin(summand->operands()), cend(summand->operands()));
+                else
+                    result.push_back(summand);
+
+            return result;
+        }
+
+        bool isSinOrCosSquare(const Base& summand)
+        {
+            const BasePtr nonConst(summand.nonConstTerm());
+            const Name sin{"sin"};
+            const Name cos{"cos"};
+
+            if (!isPower(*nonConst) || nonConst->exp()->numericEval() != 2)
+                return false;
+
+            const BasePtr base(nonConst->base());
+
+            return isFunction(*base) && (base->name() == sin || base->name() == cos);
+        }
+
+        BasePtrList simplBulk(const BasePtrList& summands)
+        /* Like terms are grouped by their non-numeric part in a hash map, numeric coefficients are
+         * summed up in place and the result is sorted once. This is equivalent to the recursive
+         * merge of summands as long as no sin(x)^2 + cos(x)^2 contraction is possible, which the
+         * caller ensures. */
+        {
+            struct Group {
+                BasePtr first;
+                BasePtr nonNumeric;
+                Number coeff;
+                bool merged;
+            };
+            std::unordered_map<BasePtr, std::size_t> lookup;
+            std::vector<Group> groups;
+            std::vector<BasePtr> result;
+
+            lookup.reserve(summands.size());
+            groups.reserve(summands.size());
+
+            for (const auto& summand : summands) {
+                BasePtr nonNumeric = summand->nonNumericTerm();
+                const Number coeff = *summand->numericTerm()->numericEval();
+
+                if (const auto [it, inserted] = lookup.insert({nonNumeric, groups.size()}); inserted)
+                    groups.push_back({summand, std::move(nonNumeric), coeff, false});
+                else {
+                    Group& group = groups[it->second];
+
+                    group.coeff += coeff;
+                    group.merged = true;
+                }
+            }
+
+            result.reserve(groups.size());
+
+            for (const auto& group : groups)
+                if (group.coeff == 0)
+                    continue;
+                else if (group.merged)
+                    result.push_back(Product::create(Numeric::create(group.coeff), group.nonNumeric));
+                else
+                    result.push_back(group.first);
+
+            std::stable_sort(
+              begin(result), end(result), [](const auto& lhs, const auto& rhs) { return doPermute(*rhs, *lhs); });
+
+            return {cbegin(result), cend(result)};
+        }
+
         BasePtrList simplWithoutCache(const BasePtrList& summands)
         {
+            if (summands.size() >= bulkThreshold) {
+                const BasePtrList flat = flatten(summands);
+
+                if (std::none_of(cbegin(flat), cend(flat), [](const auto& s) { return isSinOrCosSquare(*s); }))
+                    return simplBulk(flat);
+            }
+
             if (summands.size() == 2)
                 return simplTwoSummands(summands);
             else
@@ -237,8 +326,8 @@ namespace tsym {
 
 tsym::BasePtrList tsym::simplifySum(const BasePtrList& summands)
 {
-    static RegisteredCache<BasePtrList, BasePtrList> cache;
-    static auto& map(cache.map);
+    thread_local RegisteredCache<BasePtrList, BasePtrList> cache;
+    thread_local auto& map(cache.map);
 
     if (const auto lookup = map.find(summands); lookup != cend(map))
         return lookup->second;
@@ -1,6 +1,7 @@
 
 #include "symbol.h"
 #include <boost/functional/hash.hpp>
+#include <mutex>
 #include <unordered_map>
 #include <utility>
 #include "basefct.h"
@@ -11,7 +12,7 @@
 #include "numeric.h"
 #include "undefined.h"
 
-unsigned tsym::Symbol::tmpCounter = 0;
+std::atomic<unsigned long long> tsym::Symbol::tmpCounter{0};
 
 tsym::Symbol::Symbol(Name name, bool positive, Base::CtorKey&&)
     : Base(typestring::symbol)
@@ -21,7 +22,7 @@ tsym::Symbol::Symbol(Name name, bool positive, Base::CtorKey&&)
     setDebugString();
 }
 
-tsym::Symbol::Symbol(unsigned tmpId, bool positive, Base::CtorKey&&)
+tsym::Symbol::Symbol(unsigned long long tmpId, bool positive, Base::CtorKey&&)
     : Base(typestring::symbol)
     , symbolName{std::string(tmpSymbolNamePrefix) + std::to_string(tmpId)}
     , positive(positive)
@@ -29,12 +30,6 @@ tsym::Symbol::Symbol(unsigned tmpId, bool positive, Base::CtorKey&&)
     setDebugString();
 }
 
-tsym::Symbol::~Symbol()
-{
-    if (symbolName.value.find(tmpSymbolNamePrefix) == 0)
-        --tmpCounter;
-}
-
 tsym::BasePtr tsym::Symbol::create(std::string_view name)
 {
     return create(Name{std::string(name)});
@@ -64,7 +59,9 @@ tsym::BasePtr tsym::Symbol::createNonEmptyName(const Name& name, bool positive)
 {
     using Key = std::pair<Name, bool>;
     static std::unordered_map<Key, BasePtr, boost::hash<Key>> pool;
+    static std::mutex poolMutex;
     const auto key = std::make_pair(name, positive);
+    std::lock_guard<std::mutex> lock(poolMutex);
 
     if (const auto lookup = pool.find(key); lookup != cend(pool))
         return lookup->second;
@@ -84,9 +81,7 @@ tsym::BasePtr tsym::Symbol::createPositive(const Name& name)
 
 tsym::BasePtr tsym::Symbol::createTmpSymbol(bool positive)
 {
-    ++tmpCounter;
-
-    return std::make_shared<const Symbol>(tmpCounter, positive, Base::CtorKey{});
+    return std::make_shared<const Symbol>(++tmpCounter, positive, Base::CtorKey{});
 }
 
 bool tsym::Symbol::isEqualDifferentBase(const Base& other) const
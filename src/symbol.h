@@ -1,6 +1,7 @@
 #ifndef TSYM_SYMBOL_H
 #define TSYM_SYMBOL_H
 
+#include <atomic>
 #include <string>
 #include <string_view>
 #include "base.h"
@@ -17,12 +18,12 @@ namespace tsym {
         static BasePtr createTmpSymbol(bool positive = false);
 
         Symbol(Name name, bool positive, Base::CtorKey&&);
-        Symbol(unsigned tmpId, bool positive, Base::CtorKey&&);
+        Symbol(unsigned long long tmpId, bool positive, Base::CtorKey&&);
         Symbol(const Symbol&) = delete;
         Symbol& operator=(const Symbol&) = delete;
         Symbol(Symbol&&) = delete;
         Symbol& operator=(Symbol&&) = delete;
-        ~Symbol() override;
+        ~Symbol() override = default;
 
         bool isEqualDifferentBase(const Base& other) const override;
         std::optional<Number> numericEval() const override;
@@ -42,7 +43,10 @@ namespace tsym {
 
         const Name symbolName;
         const bool positive;
-        static unsigned tmpCounter;
+        /* Shared by all threads and never decremented, as temporary symbols can be destroyed on
+         * another thread than the one that created them, e.g. when caches are cleared. Reusing
+         * identifiers could hence give two different temporaries the same name: */
+        static std::atomic<unsigned long long> tmpCounter;
         static constexpr std::string_view tmpSymbolNamePrefix = "tmp#";
     };
 }
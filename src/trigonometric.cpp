@@ -499,6 +499,22 @@ tsym::BasePtr tsym::Trigonometric::subst(const Base& from, const BasePtr& to) co
         return create(type, arg1->subst(from, to));
 }
 
+tsym::BasePtr tsym::Trigonometric::subst(const BasePtrMap& replacements) const
+{
+    if (const auto lookup = replacements.find(clone()); lookup != cend(replacements))
+        return lookup->second;
+
+    const BasePtr newArg1(arg1->subst(replacements));
+
+    if (type == Type::ATAN2) {
+        const BasePtr newArg2(arg2->subst(replacements));
+
+        return newArg1 == arg1 && newArg2 == arg2 ? clone() : createAtan2(newArg1, newArg2);
+    }
+
+    return newArg1 == arg1 ? clone() : create(type, newArg1);
+}
+
 bool tsym::Trigonometric::isPositive() const
 {
     if (type == Type::ATAN)
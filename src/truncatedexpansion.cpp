@@ -0,0 +1,218 @@
+
+#include "truncatedexpansion.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include "basefct.h"
+#include "int.h"
+#include "number.h"
+#include "numeric.h"
+#include "power.h"
+#include "product.h"
+#include "sum.h"
+
+namespace tsym {
+    namespace {
+        using Degrees = std::vector<Number>;
+
+        Number degree(const Base& term, const Base& variable)
+        {
+            if (term.isEqual(variable))
+                return 1;
+            else if (isPower(term) && term.base()->isEqual(variable) && isNumeric(*term.exp()))
+                /* Denominators count as degree zero, such that no factor lowers the degree: */
+                return std::max(*term.exp()->numericEval(), Number(0));
+            else if (!isProduct(term))
+                return 0;
+
+            Number result(0);
+
+            for (const auto& factor : term.operands())
+                result += degree(*factor, variable);
+
+            return result;
+        }
+
+        Degrees degrees(const Base& term, const ExpansionBound& bound)
+        {
+            Degrees result;
+
+            for (const auto& variable : bound.variables)
+                result.push_back(degree(term, *variable));
+
+            return result;
+        }
+
+        bool isWithinBound(const Degrees& degrees, const ExpansionBound& bound)
+        {
+            Number total(0);
+
+            for (std::size_t i = 0; i < degrees.size(); ++i) {
+                if (!bound.maxDegrees.empty() && bound.maxDegrees[i] && degrees[i] > *bound.maxDegrees[i])
+                    return false;
+
+                total += degrees[i];
+            }
+
+            return !bound.maxTotalDegree || total <= *bound.maxTotalDegree;
+        }
+
+        BasePtrList terms(const BasePtr& expanded)
+        {
+            if (isSum(*expanded))
+                return expanded->operands();
+            else if (isZero(*expanded))
+                return {};
+            else
+                return {expanded};
+        }
+
+        BasePtr truncate(const BasePtr& expanded, const ExpansionBound& bound)
+        {
+            BasePtrList result;
+
+            for (const auto& term : terms(expanded))
+                if (isWithinBound(degrees(*term, bound), bound))
+                    result.push_back(term);
+
+            return result.empty() ? Numeric::zero() : Sum::create(result);
+        }
+
+        Degrees add(const Degrees& lhs, const Degrees& rhs)
+        {
+            Degrees result(lhs);
+
+            for (std::size_t i = 0; i < rhs.size(); ++i)
+                result[i] += rhs[i];
+
+            return result;
+        }
+
+        BasePtr multiply(const BasePtr& lhs, const BasePtr& rhs, const ExpansionBound& bound)
+        /* Both arguments are truncated expansions. Products of terms are only created if their
+         * degrees are within the bound, and the final truncation is only necessary for rare cases
+         * like sqrt(a)*sqrt(a), where the product isn't a monomial with the summed degrees. */
+        {
+            const BasePtrList rhsTerms = terms(rhs);
+            std::vector<Degrees> rhsDegrees;
+            BasePtrList result;
+
+            for (const auto& term : rhsTerms)
+                rhsDegrees.push_back(degrees(*term, bound));
+
+            for (const auto& lhsTerm : terms(lhs)) {
+                const Degrees lhsDegrees = degrees(*lhsTerm, bound);
+                auto rhsDegree = cbegin(rhsDegrees);
+
+                for (const auto& rhsTerm : rhsTerms)
+                    if (isWithinBound(add(lhsDegrees, *rhsDegree++), bound))
+                        result.push_back(Product::create(lhsTerm, rhsTerm)->expand());
+            }
+
+            return result.empty() ? Numeric::zero() : truncate(Sum::create(result), bound);
+        }
+
+        Number cancellation(const Base& expr, const Base& variable)
+        /* Upper bound for the negative exponent of the variable in any term of the expansion, i.e.,
+         * the degree by which multiplying with a term of expr can cancel the degree of another
+         * factor, e.g. 2 for (1/a + b)^2. */
+        {
+            if (isPower(expr) && expr.base()->isEqual(variable) && isNumeric(*expr.exp()))
+                return std::max(-*expr.exp()->numericEval(), Number(0));
+            else if (isPower(expr) && isInteger(*expr.exp()) && !expr.exp()->isNegative())
+                return *expr.exp()->numericEval() * cancellation(*expr.base(), variable);
+
+            Number result(0);
+
+            for (const auto& operand : expr.operands())
+                if (isProduct(expr))
+                    result += cancellation(*operand, variable);
+                else if (isSum(expr))
+                    result = std::max(result, cancellation(*operand, variable));
+
+            return result;
+        }
+
+        ExpansionBound relaxed(const ExpansionBound& bound, const Base& expr)
+        /* Terms of factors of expr must not be dropped early if another factor can cancel their
+         * degree. The bound is hence raised by the possible cancellation, and the final result
+         * must be truncated with the original bound. */
+        {
+            ExpansionBound result(bound);
+            auto variable = cbegin(bound.variables);
+            int total = 0;
+
+            for (std::size_t i = 0; i < bound.variables.size(); ++i) {
+                const auto slack = static_cast<int>(std::ceil(cancellation(expr, **variable++).toDouble()));
+
+                if (!result.maxDegrees.empty() && result.maxDegrees[i])
+                    *result.maxDegrees[i] += slack;
+
+                total += slack;
+            }
+
+            if (result.maxTotalDegree)
+                *result.maxTotalDegree += total;
+
+            return result;
+        }
+
+        BasePtr expandPower(const BasePtr& power, const ExpansionBound& bound);
+
+        BasePtr expand(const BasePtr& arg, const ExpansionBound& bound)
+        {
+            BasePtrList summands;
+            BasePtr product = Numeric::one();
+
+            if (isSum(*arg)) {
+                for (const auto& summand : arg->operands())
+                    summands.push_back(expand(summand, bound));
+
+                return Sum::create(summands);
+            } else if (isProduct(*arg)) {
+                const ExpansionBound relaxedBound = relaxed(bound, *arg);
+
+                for (const auto& factor : arg->operands())
+                    product = multiply(product, expand(factor, relaxedBound), relaxedBound);
+
+                return truncate(product, bound);
+            } else if (isPower(*arg))
+                return expandPower(arg, bound);
+            else
+                return truncate(arg->expand(), bound);
+        }
+
+        BasePtr expandPower(const BasePtr& power, const ExpansionBound& bound)
+        /* Positive integer powers are computed by repeated squaring, with truncation after each
+         * multiplication. Everything else is expanded as usual, as it doesn't contribute to the
+         * degree or is a denominator. */
+        {
+            const BasePtr exp = power->exp();
+
+            if (!isInteger(*exp) || exp->isNegative() || !fitsInto<unsigned>(exp->numericEval()->numerator()))
+                return truncate(power->expand(), bound);
+
+            const ExpansionBound relaxedBound = relaxed(bound, *power);
+            auto n = static_cast<unsigned>(exp->numericEval()->numerator());
+            BasePtr square = expand(power->base(), relaxedBound);
+            BasePtr result = Numeric::one();
+
+            for (; n > 0 && !isZero(*square); n /= 2) {
+                if (n % 2 == 1)
+                    result = multiply(result, square, relaxedBound);
+
+                if (n > 1)
+                    square = multiply(square, square, relaxedBound);
+            }
+
+            return n == 0 ? truncate(result, bound) : Numeric::zero();
+        }
+    }
+}
+
+tsym::BasePtr tsym::expandTruncated(const BasePtr& arg, const ExpansionBound& bound)
+{
+    assert(bound.maxDegrees.empty() || bound.maxDegrees.size() == bound.variables.size());
+
+    return expand(arg, bound);
+}
@@ -0,0 +1,26 @@
+#ifndef TSYM_TRUNCATEDEXPANSION_H
+#define TSYM_TRUNCATEDEXPANSION_H
+
+#include <optional>
+#include <vector>
+#include "baseptr.h"
+#include "baseptrlist.h"
+
+namespace tsym {
+    struct ExpansionBound {
+        /* Expressions with bounded degree, usually Symbols: */
+        BasePtrList variables;
+        /* Either empty or one entry per variable: */
+        std::vector<std::optional<int>> maxDegrees;
+        std::optional<int> maxTotalDegree;
+    };
+
+    /* Expansion that drops all terms, whose degree in one of the variables or total degree in all
+     * variables exceeds the given bound. The degree of a term is the sum of the positive numeric
+     * exponents of the variables among its factors, i.e., denominators count as degree zero and
+     * aren't truncated. Terms of products and powers are checked before they are created, such
+     * that expansions like (1 + a + a^2)^100 up to a^2 are cheap. */
+    BasePtr expandTruncated(const BasePtr& arg, const ExpansionBound& bound);
+}
+
+#endif
@@ -85,6 +85,16 @@ tsym::BasePtr tsym::Undefined::subst(const Base& from, const BasePtr& to) const
         return clone();
 }
 
+tsym::BasePtr tsym::Undefined::subst(const BasePtrMap& replacements) const
+/* Undefined objects never compare equal, so a map lookup won't work here: */
+{
+    for (const auto& [from, to] : replacements)
+        if (isUndefined(*from))
+            return to;
+
+    return clone();
+}
+
 int tsym::Undefined::degree(const Base&) const
 /* Same as in the has-method. */
 {
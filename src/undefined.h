@@ -31,6 +31,7 @@ namespace tsym {
         bool isDifferent(const Base& other) const override;
         bool has(const Base& other) const override;
         BasePtr subst(const Base& from, const BasePtr& to) const override;
+        BasePtr subst(const BasePtrMap& replacements) const override;
         int degree(const Base& variable) const override;
     };
 }
@@ -0,0 +1,901 @@
+
+#include "unipoly.h"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <tuple>
+#include "int.h"
+#include "modpoly.h"
+#include "numberfct.h"
+#include "sparsepoly.h"
+
+namespace tsym {
+    namespace {
+        using IntCoeffs = std::vector<Int>;
+        using modp::DenseCoeffs;
+
+        /* Minimal number of coefficients of the shorter factor for the Karatsuba algorithm and the
+         * number-theoretic transform, and the minimal degrees for fast division and half-gcd: */
+        const std::size_t karatsubaThreshold = 24;
+        const std::size_t nttThreshold = 96;
+        const int fastDivisionThreshold = 64;
+        const int halfGcdThreshold = 64;
+        /* A polynomial with degree d and n terms is only considered dense enough if d is below
+         * sparsityFactor*n + sparsityOffset: */
+        const std::size_t sparsityFactor = 8;
+        const std::size_t sparsityOffset = 32;
+        /* Limits the number of images for the modular gcd, as in ModularGcd: */
+        const int maxNumberOfPrimes = 64;
+
+        struct IntRing {
+            using Element = Int;
+
+            Int zero() const
+            {
+                return 0;
+            }
+
+            Int add(const Int& lhs, const Int& rhs) const
+            {
+                return lhs + rhs;
+            }
+
+            Int subtract(const Int& lhs, const Int& rhs) const
+            {
+                return lhs - rhs;
+            }
+
+            Int multiply(const Int& lhs, const Int& rhs) const
+            {
+                return lhs * rhs;
+            }
+        };
+
+        struct ModRing {
+            using Element = std::uint64_t;
+
+            std::uint64_t zero() const
+            {
+                return 0;
+            }
+
+            std::uint64_t add(std::uint64_t lhs, std::uint64_t rhs) const
+            {
+                return (lhs + rhs) % prime;
+            }
+
+            std::uint64_t subtract(std::uint64_t lhs, std::uint64_t rhs) const
+            {
+                return (lhs + prime - rhs) % prime;
+            }
+
+            std::uint64_t multiply(std::uint64_t lhs, std::uint64_t rhs) const
+            {
+                return lhs * rhs % prime;
+            }
+
+            std::uint64_t prime;
+        };
+
+        template <class Ring> using Elements = std::vector<typename Ring::Element>;
+
+        template <class Ring>
+        void addShifted(Elements<Ring>& target, const Elements<Ring>& source, std::size_t offset, const Ring& ring)
+        {
+            for (std::size_t i = 0; i < source.size(); ++i)
+                target[offset + i] = ring.add(target[offset + i], source[i]);
+        }
+
+        template <class Ring>
+        Elements<Ring> schoolbook(const typename Ring::Element* u, std::size_t n, const typename Ring::Element* v,
+          std::size_t m, const Ring& ring)
+        {
+            Elements<Ring> result(n + m - 1, ring.zero());
+
+            for (std::size_t i = 0; i < n; ++i)
+                for (std::size_t j = 0; j < m; ++j)
+                    result[i + j] = ring.add(result[i + j], ring.multiply(u[i], v[j]));
+
+            return result;
+        }
+
+        template <class Ring>
+        Elements<Ring> karatsuba(const typename Ring::Element* u, std::size_t n, const typename Ring::Element* v,
+          std::size_t m, const Ring& ring)
+        /* Product of the non-empty coefficient ranges u and v. */
+        {
+            if (n < m)
+                return karatsuba(v, m, u, n, ring);
+            else if (m < karatsubaThreshold)
+                return schoolbook(u, n, v, m, ring);
+
+            Elements<Ring> result(n + m - 1, ring.zero());
+
+            if (2 * m <= n) {
+                /* Unbalanced lengths, split u into chunks of v's length: */
+                for (std::size_t i = 0; i < n; i += m)
+                    addShifted(result, karatsuba(u + i, std::min(m, n - i), v, m, ring), i, ring);
+
+                return result;
+            }
+
+            /* Now, n/2 < m <= n, such that all parts are non-empty: */
+            const std::size_t k = n / 2;
+            const Elements<Ring> low = karatsuba(u, k, v, k, ring);
+            const Elements<Ring> high = karatsuba(u + k, n - k, v + k, m - k, ring);
+            Elements<Ring> uSum(u + k, u + n);
+            Elements<Ring> vSum(v + k, v + m);
+
+            vSum.resize(std::max(m - k, k), ring.zero());
+
+            for (std::size_t i = 0; i < k; ++i) {
+                uSum[i] = ring.add(uSum[i], u[i]);
+                vSum[i] = ring.add(vSum[i], v[i]);
+            }
+
+            Elements<Ring> middle = karatsuba(uSum.data(), uSum.size(), vSum.data(), vSum.size(), ring);
+
+            for (std::size_t i = 0; i < low.size(); ++i)
+                middle[i] = ring.subtract(middle[i], low[i]);
+
+            for (std::size_t i = 0; i < high.size(); ++i)
+                middle[i] = ring.subtract(middle[i], high[i]);
+
+            addShifted(result, low, 0, ring);
+            addShifted(result, middle, k, ring);
+            addShifted(result, high, 2 * k, ring);
+
+            return result;
+        }
+
+        struct NttPrime {
+            std::uint64_t prime;
+            std::uint64_t generator;
+            /* The multiplicative group has an element of order 2^maxLog: */
+            unsigned maxLog;
+        };
+
+        const std::array<NttPrime, 6> nttPrimes{{{2013265921, 31, 27}, {469762049, 3, 26}, {167772161, 3, 25},
+          {754974721, 11, 24}, {998244353, 3, 23}, {1004535809, 3, 21}}};
+
+        void ntt(DenseCoeffs& a, std::uint64_t root, std::uint64_t prime)
+        /* Iterative in-place transform. The size of a must be a power of two and root a primitive
+         * root of unity of this order. */
+        {
+            const std::size_t n = a.size();
+
+            for (std::size_t i = 1, j = 0; i < n; ++i) {
+                std::size_t bit = n >> 1;
+
+                for (; (j & bit) != 0; bit >>= 1)
+                    j ^= bit;
+
+                j ^= bit;
+
+                if (i < j)
+                    std::swap(a[i], a[j]);
+            }
+
+            for (std::size_t length = 2; length <= n; length <<= 1) {
+                const std::uint64_t step = modp::pow(root, n / length, prime);
+                const std::size_t half = length / 2;
+
+                for (std::size_t i = 0; i < n; i += length) {
+                    std::uint64_t w = 1;
+
+                    for (std::size_t j = 0; j < half; ++j) {
+                        const std::uint64_t x = a[i + j];
+                        const std::uint64_t y = a[i + j + half] * w % prime;
+
+                        a[i + j] = (x + y) % prime;
+                        a[i + j + half] = (x + prime - y) % prime;
+                        w = w * step % prime;
+                    }
+                }
+            }
+        }
+
+        DenseCoeffs nttProduct(const IntCoeffs& u, const IntCoeffs& v, std::size_t size, const NttPrime& ntt)
+        {
+            const std::uint64_t p = ntt.prime;
+            const std::uint64_t root = modp::pow(ntt.generator, (p - 1) / size, p);
+            const std::uint64_t sizeInverse = modp::inverse(size % p, p);
+            DenseCoeffs a(size, 0);
+            DenseCoeffs b(size, 0);
+
+            std::transform(cbegin(u), cend(u), begin(a), [p](const Int& c) { return modp::reduce(c, p); });
+            std::transform(cbegin(v), cend(v), begin(b), [p](const Int& c) { return modp::reduce(c, p); });
+
+            tsym::ntt(a, root, p);
+            tsym::ntt(b, root, p);
+
+            for (std::size_t i = 0; i < size; ++i)
+                a[i] = a[i] * b[i] % p;
+
+            tsym::ntt(a, modp::inverse(root, p), p);
+
+            a.resize(u.size() + v.size() - 1);
+
+            for (auto& c : a)
+                c = c * sizeInverse % p;
+
+            return a;
+        }
+
+        Int maxNorm(const IntCoeffs& u)
+        {
+            Int result(0);
+
+            for (const auto& c : u)
+                result = std::max<Int>(result, abs(c));
+
+            return result;
+        }
+
+        std::optional<IntCoeffs> multiplyNtt(const IntCoeffs& u, const IntCoeffs& v)
+        /* The product is computed modulo as many primes as necessary to recover the coefficients
+         * by the Chinese remainder theorem. Nothing is returned if the available primes don't
+         * suffice. */
+        {
+            const std::size_t length = u.size() + v.size() - 1;
+            const Int bound = 2 * maxNorm(u) * maxNorm(v) * std::min(u.size(), v.size()) + 1;
+            std::vector<const NttPrime*> primes;
+            std::size_t size = 1;
+            unsigned log = 0;
+            Int modulus(1);
+
+            for (; size < length; size <<= 1)
+                ++log;
+
+            for (const auto& ntt : nttPrimes)
+                if (modulus <= bound && ntt.maxLog >= log) {
+                    primes.push_back(&ntt);
+                    modulus *= ntt.prime;
+                }
+
+            if (modulus <= bound)
+                return std::nullopt;
+
+            std::vector<DenseCoeffs> images;
+            std::vector<std::uint64_t> inverses;
+            Int partialModulus(1);
+
+            for (const NttPrime* ntt : primes) {
+                images.push_back(nttProduct(u, v, size, *ntt));
+                inverses.push_back(modp::inverse(modp::reduce(partialModulus, ntt->prime), ntt->prime));
+                partialModulus *= ntt->prime;
+            }
+
+            IntCoeffs result(length);
+
+            for (std::size_t i = 0; i < length; ++i) {
+                /* Garner's algorithm: */
+                Int c(images.front()[i]);
+                Int m(primes.front()->prime);
+
+                for (std::size_t k = 1; k < primes.size(); ++k) {
+                    const std::uint64_t p = primes[k]->prime;
+                    const std::uint64_t t = (images[k][i] + p - modp::reduce(c, p)) % p * inverses[k] % p;
+
+                    c += m * t;
+                    m *= p;
+                }
+
+                result[i] = c > modulus / 2 ? c - modulus : c;
+            }
+
+            return result;
+        }
+
+        IntCoeffs multiply(const IntCoeffs& u, const IntCoeffs& v)
+        {
+            if (u.empty() || v.empty())
+                return {};
+            else if (std::min(u.size(), v.size()) >= nttThreshold)
+                if (auto result = multiplyNtt(u, v))
+                    return std::move(*result);
+
+            return karatsuba(u.data(), u.size(), v.data(), v.size(), IntRing{});
+        }
+
+        Int commonDenominator(const std::vector<Number>& coeffs)
+        {
+            Int result(1);
+
+            for (const auto& c : coeffs)
+                result = lcm(result, c.denominator());
+
+            return result;
+        }
+
+        IntCoeffs scaled(const std::vector<Number>& coeffs, const Int& denominator)
+        {
+            IntCoeffs result;
+
+            result.reserve(coeffs.size());
+
+            for (const auto& c : coeffs)
+                result.push_back(c.numerator() * (denominator / c.denominator()));
+
+            return result;
+        }
+
+        std::vector<Number> truncated(const std::vector<Number>& coeffs, std::size_t length)
+        {
+            return {cbegin(coeffs), cbegin(coeffs) + static_cast<long>(std::min(length, coeffs.size()))};
+        }
+
+        std::vector<Number> reversed(const std::vector<Number>& coeffs, std::size_t length)
+        /* Coefficients of x^(length - 1)*p(1/x) for a polynomial p of degree < length. */
+        {
+            std::vector<Number> result(coeffs);
+
+            result.resize(length, 0);
+
+            std::reverse(begin(result), end(result));
+
+            return result;
+        }
+
+        UniPoly seriesInverse(const UniPoly& f, std::size_t length)
+        /* Returns g with f*g = 1 mod x^length by Newton iteration g <- g*(2 - f*g), which doubles the
+         * number of correct coefficients in every step. The constant coefficient of f must be
+         * non-zero. */
+        {
+            const UniPoly two(std::vector<Number>{2});
+            UniPoly g(std::vector<Number>{1 / f.coeffs().front()});
+
+            for (std::size_t current = 1; current < length;) {
+                current = std::min(2 * current, length);
+
+                const UniPoly fg(truncated((UniPoly(truncated(f.coeffs(), current)) * g).coeffs(), current));
+
+                g = UniPoly(truncated((g * (two - fg)).coeffs(), current));
+            }
+
+            return g;
+        }
+
+        std::pair<UniPoly, UniPoly> divideNewton(const UniPoly& u, const UniPoly& v)
+        /* The reversed quotient is the product of the reversed dividend and the inverse power
+         * series of the reversed divisor, see von zur Gathen, Gerhard, Modern Computer Algebra
+         * [2013], chapter 9.1. */
+        {
+            const std::size_t length = u.coeffs().size() - v.coeffs().size() + 1;
+            const UniPoly vReversed(truncated(reversed(v.coeffs(), v.coeffs().size()), length));
+            const UniPoly uReversed(truncated(reversed(u.coeffs(), u.coeffs().size()), length));
+            const UniPoly product = uReversed * seriesInverse(vReversed, length);
+            UniPoly quotient(reversed(truncated(product.coeffs(), length), length));
+            UniPoly remainder = u - quotient * v;
+
+            return {std::move(quotient), std::move(remainder)};
+        }
+
+        std::pair<UniPoly, UniPoly> divideClassical(const UniPoly& u, const UniPoly& v)
+        {
+            const std::vector<Number>& divisor = v.coeffs();
+            const std::size_t n = divisor.size();
+            const Number lCoeffInverse = 1 / v.leadingCoeff();
+            std::vector<Number> remainder(u.coeffs());
+            std::vector<Number> quotient(remainder.size() - n + 1);
+
+            for (std::size_t i = quotient.size(); i-- > 0;) {
+                const Number factor = remainder[i + n - 1] * lCoeffInverse;
+
+                quotient[i] = factor;
+
+                if (factor != 0)
+                    for (std::size_t j = 0; j < n; ++j)
+                        remainder[i + j] -= factor * divisor[j];
+            }
+
+            remainder.resize(n - 1);
+
+            return {UniPoly(std::move(quotient)), UniPoly(std::move(remainder))};
+        }
+
+        void trim(DenseCoeffs& u)
+        {
+            while (!u.empty() && u.back() == 0)
+                u.pop_back();
+        }
+
+        int degree(const DenseCoeffs& u)
+        /* The degree of the zero polynomial is -1 here. */
+        {
+            return static_cast<int>(u.size()) - 1;
+        }
+
+        DenseCoeffs add(const DenseCoeffs& u, const DenseCoeffs& v, std::uint64_t prime)
+        {
+            DenseCoeffs result(u);
+
+            result.resize(std::max(u.size(), v.size()), 0);
+
+            for (std::size_t i = 0; i < v.size(); ++i)
+                result[i] = (result[i] + v[i]) % prime;
+
+            trim(result);
+
+            return result;
+        }
+
+        DenseCoeffs negate(const DenseCoeffs& u, std::uint64_t prime)
+        {
+            DenseCoeffs result(u);
+
+            for (auto& c : result)
+                c = (prime - c) % prime;
+
+            return result;
+        }
+
+        DenseCoeffs shiftRight(const DenseCoeffs& u, std::size_t n)
+        /* Quotient of the division by x^n. */
+        {
+            return n >= u.size() ? DenseCoeffs{} : DenseCoeffs(cbegin(u) + static_cast<long>(n), cend(u));
+        }
+
+        DenseCoeffs monic(const DenseCoeffs& u, std::uint64_t prime)
+        {
+            DenseCoeffs result(u);
+
+            if (!u.empty())
+                for (auto& c : result)
+                    c = c * modp::inverse(u.back(), prime) % prime;
+
+            return result;
+        }
+
+        struct Matrix {
+            /* Transformation of a pair of polynomials by a number of Euclidean steps: */
+            DenseCoeffs a11;
+            DenseCoeffs a12;
+            DenseCoeffs a21;
+            DenseCoeffs a22;
+        };
+
+        Matrix identity()
+        {
+            return {{1}, {}, {}, {1}};
+        }
+
+        Matrix multiply(const Matrix& lhs, const Matrix& rhs, std::uint64_t p)
+        {
+            using modp::multiply;
+
+            return {add(multiply(lhs.a11, rhs.a11, p), multiply(lhs.a12, rhs.a21, p), p),
+              add(multiply(lhs.a11, rhs.a12, p), multiply(lhs.a12, rhs.a22, p), p),
+              add(multiply(lhs.a21, rhs.a11, p), multiply(lhs.a22, rhs.a21, p), p),
+              add(multiply(lhs.a21, rhs.a12, p), multiply(lhs.a22, rhs.a22, p), p)};
+        }
+
+        std::pair<DenseCoeffs, DenseCoeffs> apply(
+          const Matrix& m, const DenseCoeffs& u, const DenseCoeffs& v, std::uint64_t p)
+        {
+            using modp::multiply;
+
+            return {add(multiply(m.a11, u, p), multiply(m.a12, v, p), p),
+              add(multiply(m.a21, u, p), multiply(m.a22, v, p), p)};
+        }
+
+        Matrix euclideanStep(const DenseCoeffs& quotient, std::uint64_t p)
+        /* Maps (u, v) onto (v, u - quotient*v). */
+        {
+            return {{}, {1}, {1}, negate(quotient, p)};
+        }
+
+        Matrix euclideanSteps(DenseCoeffs u, DenseCoeffs v, int minDegree, std::uint64_t p)
+        /* Plain Euclidean algorithm until the degree of the second polynomial is below the given
+         * one, used as the base case of the half-gcd algorithm. */
+        {
+            Matrix result = identity();
+
+            while (degree(v) >= minDegree) {
+                auto [quotient, remainder] = modp::divide(u, v, p);
+
+                result = multiply(euclideanStep(quotient, p), result, p);
+                u = std::move(v);
+                v = std::move(remainder);
+            }
+
+            return result;
+        }
+
+        Matrix halfGcd(const DenseCoeffs& u, const DenseCoeffs& v, std::uint64_t p)
+        /* For deg(u) > deg(v), the returned matrix maps (u, v) onto the consecutive pair of
+         * remainders in the Euclidean remainder sequence with degrees of at least and below
+         * ceil(deg(u)/2). Only the upper half of coefficients determines the quotients up to this
+         * point, which the recursion works on. See Yap, Fundamental Problems of Algorithmic
+         * Algebra [2000], chapter 2. */
+        {
+            const int m = (degree(u) + 1) / 2;
+
+            if (degree(v) < m)
+                return identity();
+            else if (degree(u) < halfGcdThreshold)
+                return euclideanSteps(u, v, m, p);
+
+            Matrix result = halfGcd(shiftRight(u, static_cast<std::size_t>(m)),
+              shiftRight(v, static_cast<std::size_t>(m)), p);
+            const auto [w, x] = apply(result, u, v, p);
+
+            if (degree(x) < m)
+                return result;
+
+            auto [quotient, y] = modp::divide(w, x, p);
+
+            result = multiply(euclideanStep(quotient, p), result, p);
+
+            if (degree(y) < m)
+                return result;
+
+            const auto k = static_cast<std::size_t>(2 * m - degree(x));
+
+            return multiply(halfGcd(shiftRight(x, k), shiftRight(y, k), p), result, p);
+        }
+
+        bool hasIntegerCoefficients(const UniPoly& u)
+        {
+            const auto& coeffs = u.coeffs();
+
+            return std::all_of(cbegin(coeffs), cend(coeffs), [](const Number& c) { return isInt(c); });
+        }
+
+        IntCoeffs primitivePart(const IntCoeffs& u)
+        {
+            Int content(0);
+            IntCoeffs result(u);
+
+            for (const auto& c : u)
+                content = gcd(content, c);
+
+            for (auto& c : result)
+                c /= content;
+
+            return result;
+        }
+
+        IntCoeffs toIntCoeffs(const UniPoly& u)
+        {
+            return scaled(u.coeffs(), 1);
+        }
+
+        UniPoly toUniPoly(const IntCoeffs& u)
+        {
+            std::vector<Number> coeffs;
+
+            coeffs.reserve(u.size());
+
+            for (const auto& c : u)
+                coeffs.emplace_back(c);
+
+            return UniPoly(std::move(coeffs));
+        }
+
+        DenseCoeffs reduce(const IntCoeffs& u, std::uint64_t prime)
+        {
+            DenseCoeffs result;
+
+            result.reserve(u.size());
+
+            for (const auto& c : u)
+                result.push_back(modp::reduce(c, prime));
+
+            trim(result);
+
+            return result;
+        }
+
+        IntCoeffs symmetric(const DenseCoeffs& u, std::uint64_t prime)
+        {
+            IntCoeffs result;
+
+            for (const std::uint64_t c : u)
+                result.push_back(c > prime / 2 ? Int(c) - prime : Int(c));
+
+            return result;
+        }
+
+        IntCoeffs chineseRemainder(const IntCoeffs& h, const Int& modulus, const DenseCoeffs& image, std::uint64_t p)
+        /* Coefficients in the symmetric range of modulus*p congruent to h modulo modulus and to the
+         * image of the same length modulo p. */
+        {
+            const std::uint64_t inverse = modp::inverse(modp::reduce(modulus, p), p);
+            const Int product = modulus * p;
+            IntCoeffs result;
+
+            for (std::size_t i = 0; i < h.size(); ++i) {
+                const std::uint64_t factor = (image[i] + p - modp::reduce(h[i], p)) % p * inverse % p;
+                const Int c = h[i] + modulus * factor;
+
+                result.push_back(c > product / 2 ? c - product : c);
+            }
+
+            return result;
+        }
+
+        bool divides(const IntCoeffs& divisor, const IntCoeffs& dividend)
+        {
+            return divide(toUniPoly(dividend), toUniPoly(divisor)).second.isZero();
+        }
+    }
+}
+
+tsym::UniPoly::UniPoly(std::vector<Number>&& coeffs)
+    : coeffList(std::move(coeffs))
+{
+    trim();
+}
+
+std::optional<tsym::UniPoly> tsym::UniPoly::fromBase(const Base& polynomial, const BasePtr& variable)
+{
+    const auto sparse = SparsePoly::fromBase(polynomial, {variable});
+
+    if (!sparse)
+        return std::nullopt;
+    else if (sparse->isZero())
+        return UniPoly();
+
+    const auto& terms = sparse->terms();
+    /* Terms are sorted in descending order: */
+    const auto length = static_cast<std::size_t>(terms.front().exponents.front()) + 1;
+
+    if (length > sparsityFactor * terms.size() + sparsityOffset)
+        return std::nullopt;
+
+    std::vector<Number> coeffs(length, 0);
+
+    for (const auto& term : terms)
+        coeffs[static_cast<std::size_t>(term.exponents.front())] = term.coeff;
+
+    return UniPoly(std::move(coeffs));
+}
+
+tsym::BasePtr tsym::UniPoly::toBase(const BasePtr& variable) const
+{
+    std::vector<SparsePoly::Term> terms;
+
+    for (std::size_t i = coeffList.size(); i-- > 0;)
+        if (coeffList[i] != 0)
+            terms.push_back({{static_cast<int>(i)}, coeffList[i]});
+
+    return SparsePoly(1, std::move(terms)).toBase({variable});
+}
+
+tsym::UniPoly& tsym::UniPoly::operator+=(const UniPoly& rhs)
+{
+    coeffList.resize(std::max(coeffList.size(), rhs.coeffList.size()), 0);
+
+    for (std::size_t i = 0; i < rhs.coeffList.size(); ++i)
+        coeffList[i] += rhs.coeffList[i];
+
+    trim();
+
+    return *this;
+}
+
+tsym::UniPoly& tsym::UniPoly::operator-=(const UniPoly& rhs)
+{
+    return operator+=(-rhs);
+}
+
+tsym::UniPoly& tsym::UniPoly::operator*=(const UniPoly& rhs)
+/* Denominators are cleared in order to apply the fast integer multiplication. */
+{
+    if (isZero() || rhs.isZero()) {
+        coeffList.clear();
+        return *this;
+    }
+
+    const Int lhsDenominator = commonDenominator(coeffList);
+    const Int rhsDenominator = commonDenominator(rhs.coeffList);
+    const Int denominator = lhsDenominator * rhsDenominator;
+    const IntCoeffs product = multiply(scaled(coeffList, lhsDenominator), scaled(rhs.coeffList, rhsDenominator));
+
+    coeffList.clear();
+
+    for (const auto& c : product)
+        coeffList.emplace_back(c, denominator);
+
+    trim();
+
+    return *this;
+}
+
+tsym::UniPoly tsym::UniPoly::operator-() const
+{
+    UniPoly result(*this);
+
+    for (auto& c : result.coeffList)
+        c = -c;
+
+    return result;
+}
+
+bool tsym::UniPoly::isZero() const
+{
+    return coeffList.empty();
+}
+
+int tsym::UniPoly::degree() const
+{
+    return coeffList.empty() ? 0 : static_cast<int>(coeffList.size()) - 1;
+}
+
+tsym::Number tsym::UniPoly::leadingCoeff() const
+{
+    return coeffList.empty() ? 0 : coeffList.back();
+}
+
+const std::vector<tsym::Number>& tsym::UniPoly::coeffs() const
+{
+    return coeffList;
+}
+
+tsym::UniPoly tsym::UniPoly::toThe(unsigned exp) const
+{
+    UniPoly result(std::vector<Number>{1});
+    UniPoly square(*this);
+
+    for (; exp > 0; exp /= 2) {
+        if (exp % 2 == 1)
+            result *= square;
+
+        if (exp > 1)
+            square *= square;
+    }
+
+    return result;
+}
+
+void tsym::UniPoly::trim()
+{
+    while (!coeffList.empty() && coeffList.back() == 0)
+        coeffList.pop_back();
+}
+
+bool tsym::operator==(const UniPoly& lhs, const UniPoly& rhs)
+{
+    return lhs.coeffs() == rhs.coeffs();
+}
+
+std::pair<tsym::UniPoly, tsym::UniPoly> tsym::divide(const UniPoly& u, const UniPoly& v)
+{
+    assert(!v.isZero());
+
+    if (u.coeffs().size() < v.coeffs().size())
+        return {UniPoly(), u};
+    else if (v.degree() >= fastDivisionThreshold && u.degree() - v.degree() >= fastDivisionThreshold)
+        return divideNewton(u, v);
+    else
+        return divideClassical(u, v);
+}
+
+std::optional<tsym::UniPoly> tsym::gcd(const UniPoly& u, const UniPoly& v)
+/* See Geddes, Czapor, Labahn [1992], algorithm 7.1, with the same termination criterion as
+ * ModularGcd. */
+{
+    assert(!u.isZero() && !v.isZero());
+
+    if (!hasIntegerCoefficients(u) || !hasIntegerCoefficients(v))
+        return std::nullopt;
+
+    const IntCoeffs U = primitivePart(toIntCoeffs(u));
+    const IntCoeffs V = primitivePart(toIntCoeffs(v));
+    const Int c = gcd(u.leadingCoeff().numerator() / U.back(), v.leadingCoeff().numerator() / V.back());
+    const Int g = gcd(U.back(), V.back());
+    std::optional<IntCoeffs> h;
+    std::uint64_t prime = modp::largestPrime;
+    Int modulus;
+
+    for (int i = 0; i < maxNumberOfPrimes; ++i, prime = modp::previousPrime(prime)) {
+        const std::uint64_t gImage = modp::reduce(g, prime);
+
+        if (modp::reduce(U.back(), prime) == 0 || modp::reduce(V.back(), prime) == 0)
+            continue;
+
+        DenseCoeffs image = modp::gcd(reduce(U, prime), reduce(V, prime), prime);
+
+        if (image.size() == 1)
+            return UniPoly(std::vector<Number>{Number(abs(c))});
+
+        for (auto& coeff : image)
+            coeff = coeff * gImage % prime;
+
+        if (h && image.size() > h->size())
+            continue;
+        else if (!h || image.size() < h->size()) {
+            h = symmetric(image, prime);
+            modulus = prime;
+            continue;
+        }
+
+        IntCoeffs next = chineseRemainder(*h, modulus, image, prime);
+
+        modulus *= prime;
+
+        if (next == *h) {
+            IntCoeffs pp = primitivePart(next);
+
+            if (divides(pp, U) && divides(pp, V))
+                return UniPoly(pp.back() < 0 ? -toUniPoly(pp) : toUniPoly(pp)) * UniPoly({Number(abs(c))});
+        }
+
+        h = std::move(next);
+    }
+
+    return std::nullopt;
+}
+
+tsym::modp::DenseCoeffs tsym::modp::multiply(const DenseCoeffs& u, const DenseCoeffs& v, std::uint64_t prime)
+{
+    if (u.empty() || v.empty())
+        return {};
+
+    DenseCoeffs result = karatsuba(u.data(), u.size(), v.data(), v.size(), ModRing{prime});
+
+    trim(result);
+
+    return result;
+}
+
+std::pair<tsym::modp::DenseCoeffs, tsym::modp::DenseCoeffs> tsym::modp::divide(
+  const DenseCoeffs& u, const DenseCoeffs& v, std::uint64_t prime)
+{
+    assert(!v.empty() && v.back() != 0);
+
+    if (u.size() < v.size())
+        return {{}, u};
+
+    const std::size_t n = v.size();
+    const std::uint64_t lCoeffInverse = inverse(v.back(), prime);
+    DenseCoeffs remainder(u);
+    DenseCoeffs quotient(u.size() - n + 1);
+
+    for (std::size_t i = quotient.size(); i-- > 0;) {
+        const std::uint64_t factor = remainder[i + n - 1] * lCoeffInverse % prime;
+
+        quotient[i] = factor;
+
+        if (factor != 0)
+            for (std::size_t j = 0; j < n; ++j)
+                remainder[i + j] = (remainder[i + j] + prime - factor * v[j] % prime) % prime;
+    }
+
+    remainder.resize(n - 1);
+
+    tsym::trim(quotient);
+    tsym::trim(remainder);
+
+    return {std::move(quotient), std::move(remainder)};
+}
+
+tsym::modp::DenseCoeffs tsym::modp::gcd(const DenseCoeffs& u, const DenseCoeffs& v, std::uint64_t prime)
+/* Each step reduces the pair by a half-gcd computation, followed by one plain Euclidean step. */
+{
+    DenseCoeffs a(u);
+    DenseCoeffs b(v);
+
+    tsym::trim(a);
+    tsym::trim(b);
+
+    if (a.size() < b.size())
+        std::swap(a, b);
+
+    while (!b.empty()) {
+        if (degree(a) >= halfGcdThreshold && a.size() > b.size()) {
+            std::tie(a, b) = apply(halfGcd(a, b, prime), a, b, prime);
+
+            if (b.empty())
+                break;
+        }
+
+        DenseCoeffs remainder = divide(a, b, prime).second;
+
+        a = std::move(b);
+        b = std::move(remainder);
+    }
+
+    return monic(a, prime);
+}
@@ -0,0 +1,71 @@
+#ifndef TSYM_UNIPOLY_H
+#define TSYM_UNIPOLY_H
+
+#include <boost/operators.hpp>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+#include "baseptr.h"
+#include "number.h"
+
+namespace tsym {
+    class UniPoly : private boost::equality_comparable<UniPoly, boost::ring_operators<UniPoly>> {
+        /* Dense univariate polynomial with rational coefficients, stored in ascending order of the
+         * exponent without trailing zeros. Products are computed on integer coefficients after
+         * clearing denominators, by schoolbook multiplication for small, the Karatsuba algorithm for
+         * medium and a number-theoretic transform modulo a few primes for large degrees. */
+      public:
+        UniPoly() = default;
+        explicit UniPoly(std::vector<Number>&& coeffs);
+
+        /* Returns nothing if the argument isn't a polynomial in the given symbol with rational
+         * coefficients, or if it's too sparse for a dense representation: */
+        static std::optional<UniPoly> fromBase(const Base& polynomial, const BasePtr& variable);
+        BasePtr toBase(const BasePtr& variable) const;
+
+        UniPoly& operator+=(const UniPoly& rhs);
+        UniPoly& operator-=(const UniPoly& rhs);
+        UniPoly& operator*=(const UniPoly& rhs);
+        UniPoly operator-() const;
+
+        bool isZero() const;
+        /* The degree of the zero polynomial is zero: */
+        int degree() const;
+        /* Zero for the zero polynomial: */
+        Number leadingCoeff() const;
+        const std::vector<Number>& coeffs() const;
+
+        UniPoly toThe(unsigned exp) const;
+
+      private:
+        void trim();
+
+        std::vector<Number> coeffList;
+    };
+
+    bool operator==(const UniPoly& lhs, const UniPoly& rhs);
+
+    /* Division with remainder, v must be non-zero. For large degrees, the quotient is computed from
+     * the reversed polynomials by a power series inversion with Newton iteration. First element of
+     * the result is the quotient, second the remainder. */
+    std::pair<UniPoly, UniPoly> divide(const UniPoly& u, const UniPoly& v);
+    /* Modular gcd for non-zero polynomials with integer coefficients, using the half-gcd algorithm
+     * modulo each prime. The result has a positive leading coefficient. Nothing is returned for
+     * non-integer coefficients or when too many primes would be needed. */
+    std::optional<UniPoly> gcd(const UniPoly& u, const UniPoly& v);
+
+    namespace modp {
+        /* Dense univariate polynomials with coefficients modulo a prime p < 2^32, stored in
+         * ascending order of the exponent without trailing zeros. */
+        using DenseCoeffs = std::vector<std::uint64_t>;
+
+        DenseCoeffs multiply(const DenseCoeffs& u, const DenseCoeffs& v, std::uint64_t prime);
+        std::pair<DenseCoeffs, DenseCoeffs> divide(const DenseCoeffs& u, const DenseCoeffs& v, std::uint64_t prime);
+        /* Half-gcd algorithm for large degrees, Euclid's algorithm otherwise. The result is monic or
+         * empty, if both u and v are zero: */
+        DenseCoeffs gcd(const DenseCoeffs& u, const DenseCoeffs& v, std::uint64_t prime);
+    }
+}
+
+#endif
@@ -0,0 +1,167 @@
+
+#include "zerotest.h"
+#include <cassert>
+#include <cmath>
+#include <random>
+#include <unordered_map>
+#include "base.h"
+#include "basefct.h"
+#include "int.h"
+#include "modpoly.h"
+#include "numberfct.h"
+
+namespace tsym {
+    namespace {
+        /* Primes are picked randomly from [2^30, 2^31), such that the polynomial numerator of the
+         * expression can't vanish identically for all of them: */
+        const std::uint64_t minPrime = std::uint64_t{1} << 30;
+        /* Points at which a denominator vanishes are skipped, this limits the number of retries: */
+        const int maxNumberOfUnusablePoints = 10;
+
+        std::optional<Int> degreeBound(const Base& expr)
+        /* Upper bound for the degree of numerator plus the degree of the denominator, when the
+         * expression is normalized. Nothing is returned for non-rational expressions. */
+        {
+            if (isNumeric(expr))
+                return expr.numericEval()->isRational() ? std::optional<Int>(0) : std::nullopt;
+            else if (isSymbol(expr))
+                return Int(1);
+            else if (isSum(expr) || isProduct(expr)) {
+                Int result(0);
+
+                for (const auto& operand : expr.operands())
+                    if (const auto degree = degreeBound(*operand))
+                        result += *degree;
+                    else
+                        return std::nullopt;
+
+                return result;
+            } else if (isPower(expr) && isNumeric(*expr.exp()) && isInt(*expr.exp()->numericEval()))
+                if (const auto degree = degreeBound(*expr.base()))
+                    return *degree * abs(expr.exp()->numericEval()->numerator());
+
+            return std::nullopt;
+        }
+
+        std::minstd_rand& engineRef()
+        /* Seeded once per thread, such that every call of the test uses fresh primes and points. A
+         * fixed seed would misjudge an expression vanishing at these points on every call: */
+        {
+            thread_local std::minstd_rand engine(std::random_device{}());
+
+            return engine;
+        }
+
+        std::uint64_t randomPrime(std::minstd_rand& engine)
+        {
+            std::uniform_int_distribution<std::uint64_t> distribution(minPrime + 1, 2 * minPrime);
+
+            return modp::previousPrime(distribution(engine));
+        }
+
+        class RandomPoint {
+          public:
+            explicit RandomPoint(std::minstd_rand& engine)
+                : engine(engine)
+                , prime(randomPrime(engine))
+            {}
+
+            /* Nothing is returned if a denominator vanishes: */
+            std::optional<std::uint64_t> evaluate(const Base& expr)
+            {
+                if (isNumeric(expr))
+                    return evaluateNumeric(*expr.numericEval());
+                else if (isSymbol(expr))
+                    return value(expr);
+                else if (isSum(expr) || isProduct(expr)) {
+                    std::uint64_t result = isSum(expr) ? 0 : 1;
+
+                    for (const auto& operand : expr.operands())
+                        if (const auto value = evaluate(*operand))
+                            result = isSum(expr) ? (result + *value) % prime : result * *value % prime;
+                        else
+                            return std::nullopt;
+
+                    return result;
+                }
+
+                assert(isPower(expr));
+
+                return evaluatePower(expr);
+            }
+
+          private:
+            std::optional<std::uint64_t> evaluateNumeric(const Number& n) const
+            {
+                const std::uint64_t denominator = modp::reduce(n.denominator(), prime);
+
+                if (denominator == 0)
+                    return std::nullopt;
+
+                return modp::reduce(n.numerator(), prime) * modp::inverse(denominator, prime) % prime;
+            }
+
+            std::uint64_t value(const Base& symbol)
+            {
+                const auto lookup = values.find(symbol.clone());
+
+                if (lookup != cend(values))
+                    return lookup->second;
+
+                const std::uint64_t result = std::uniform_int_distribution<std::uint64_t>(0, prime - 1)(engine);
+
+                values.insert({symbol.clone(), result});
+
+                return result;
+            }
+
+            std::optional<std::uint64_t> evaluatePower(const Base& power)
+            {
+                const auto base = evaluate(*power.base());
+                const Int exp = power.exp()->numericEval()->numerator();
+
+                if (!base || (*base == 0 && exp < 0))
+                    return std::nullopt;
+                else if (*base == 0)
+                    return 0;
+
+                /* By Fermat's little theorem, the exponent can be reduced modulo p - 1: */
+                const std::uint64_t result = modp::pow(*base, modp::reduce(abs(exp), prime - 1), prime);
+
+                return exp < 0 ? modp::inverse(result, prime) : result;
+            }
+
+            std::minstd_rand& engine;
+            const std::uint64_t prime;
+            std::unordered_map<BasePtr, std::uint64_t> values;
+        };
+    }
+}
+
+std::optional<bool> tsym::isZeroModular(const Base& expr, double errorBound)
+/* A non-zero numerator of degree d vanishes at no more than d/p of all points, see e.g. Geddes,
+ * Czapor, Labahn [1992], chapter 4.6. */
+{
+    const auto degree = degreeBound(expr);
+    std::minstd_rand& engine = engineRef();
+    int nUnusablePoints = 0;
+
+    assert(errorBound > 0.0);
+
+    if (!degree || *degree >= minPrime)
+        return std::nullopt;
+
+    const double ratio = std::max(1.0, static_cast<double>(*degree)) / static_cast<double>(minPrime);
+    const int nPoints = std::max(1, static_cast<int>(std::ceil(std::log(errorBound) / std::log(ratio))));
+
+    for (int i = 0; i < nPoints;)
+        if (const auto value = RandomPoint(engine).evaluate(expr); !value) {
+            if (++nUnusablePoints > maxNumberOfUnusablePoints)
+                return std::nullopt;
+        } else if (*value != 0)
+            return false;
+        else
+            ++i;
+
+    return true;
+}
@@ -0,0 +1,18 @@
+#ifndef TSYM_ZEROTEST_H
+#define TSYM_ZEROTEST_H
+
+#include <optional>
+#include "baseptr.h"
+
+namespace tsym {
+    /* Probabilistic zero-equivalence test after Schwartz and Zippel. The expression is evaluated
+     * at random points modulo random primes of 31 bit, without any simplification. A non-zero
+     * value proves that the expression isn't zero, i.e., false is always correct. Vanishing at all
+     * points means that the expression is zero with an error probability below the given bound,
+     * which must be positive. The number of points is chosen accordingly, based on a degree bound
+     * of the expression. Nothing is returned for expressions that aren't rational functions of
+     * symbols with rational coefficients, e.g. those containing functions or constants. */
+    std::optional<bool> isZeroModular(const Base& expr, double errorBound);
+}
+
+#endif
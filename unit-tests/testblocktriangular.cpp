@@ -0,0 +1,97 @@
+
+#include <vector>
+#include "blocktriangular.h"
+#include "boostmatrixvector.h"
+#include "functions.h"
+#include "solve.h"
+#include "tsymtests.h"
+
+using namespace tsym;
+
+struct BlockTriangularFixture {
+    const Var a{"a"};
+    const Var b{"b"};
+    const Var c{"c"};
+
+    SparsityPattern pattern(const std::vector<std::vector<std::size_t>>& rows) const
+    {
+        SparsityPattern result;
+
+        result.nRows = result.nColumns = rows.size();
+
+        for (const auto& columns : rows) {
+            result.columnIndices.insert(end(result.columnIndices), cbegin(columns), cend(columns));
+            result.rowPointers.push_back(result.columnIndices.size());
+        }
+
+        return result;
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestBlockTriangular, BlockTriangularFixture)
+
+BOOST_AUTO_TEST_CASE(emptyPattern)
+{
+    const auto form = blockTriangularForm(SparsityPattern{});
+
+    BOOST_REQUIRE(form);
+    BOOST_TEST(form->blocks.empty());
+}
+
+BOOST_AUTO_TEST_CASE(structurallySingular)
+{
+    BOOST_TEST(!blockTriangularForm(pattern({{0, 1}, {0}, {0}})));
+}
+
+BOOST_AUTO_TEST_CASE(matchingRequiresAugmentingPath)
+{
+    const auto form = blockTriangularForm(pattern({{0, 1}, {0}}));
+    const std::vector<std::size_t> expected{1, 0};
+
+    BOOST_REQUIRE(form);
+    BOOST_TEST(expected == form->rowOfColumn, per_element());
+}
+
+BOOST_AUTO_TEST_CASE(lowerTriangularYieldsSingleColumnBlocks)
+{
+    const auto form = blockTriangularForm(pattern({{0}, {0, 1}, {0, 1, 2}}));
+    const std::vector<std::vector<std::size_t>> expected{{0}, {1}, {2}};
+
+    BOOST_REQUIRE(form);
+    BOOST_TEST((expected == form->blocks));
+}
+
+BOOST_AUTO_TEST_CASE(coupledBlocksInSolvingOrder)
+/* Columns 1 and 3 are coupled and depend on nothing else, columns 0 and 2 depend on them: */
+{
+    const auto form = blockTriangularForm(pattern({{0, 2, 3}, {1, 3}, {0, 2}, {1, 3}}));
+    const std::vector<std::vector<std::size_t>> expected{{1, 3}, {0, 2}};
+
+    BOOST_REQUIRE(form);
+    BOOST_TEST((expected == form->blocks));
+}
+
+BOOST_AUTO_TEST_CASE(solveDecoupledSystem)
+{
+    auto A = createBoostMatrix({{a, 0, 0, 1}, {0, b, c, 0}, {0, 1, 2, 0}, {0, 0, 0, c}});
+    auto rhs = createBoostVector({a * a + b, 2 * b + 3 * c, 8, b * c});
+    auto x = createBoostVector({0, 0, 0, 0});
+
+    solve(A, rhs, x, x.size());
+
+    BOOST_CHECK_EQUAL(a, x(0));
+    BOOST_CHECK_EQUAL(2, x(1));
+    BOOST_CHECK_EQUAL(3, x(2));
+    BOOST_CHECK_EQUAL(b, x(3));
+}
+
+BOOST_AUTO_TEST_CASE(solveStructurallySingularSystem)
+{
+    auto A = createBoostMatrix({{a, b, 0}, {c, 0, 0}, {1, 0, 0}});
+    auto rhs = createBoostVector({1, 2, 3});
+    auto x = createBoostVector({0, 0, 0});
+
+    BOOST_CHECK_THROW(solve(A, rhs, x, x.size()), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,5 +1,6 @@
 
 #include "basefct.h"
+#include "baseptrlistfct.h"
 #include "constant.h"
 #include "fixtures.h"
 #include "numeric.h"
@@ -322,4 +323,26 @@ BOOST_AUTO_TEST_CASE(partialSumExpansionIsScalar)
     BOOST_CHECK_EQUAL(expected, result);
 }
 
+BOOST_AUTO_TEST_CASE(multinomialCoefficients)
+/* The coefficient of a^2*b*c*d in (a + b + c + d)^5 is 5!/2! = 60. */
+{
+    const BasePtr result = Power::create(Sum::create(a, b, c, d), five)->expand();
+
+    BOOST_CHECK_EQUAL(Numeric::create(60), result->coeff(*a, 2)->coeff(*b, 1)->coeff(*c, 1)->coeff(*d, 1));
+    BOOST_CHECK_EQUAL(one, result->coeff(*d, 5));
+    BOOST_CHECK_EQUAL(56, result->operands().size());
+}
+
+BOOST_AUTO_TEST_CASE(multinomialEqualsProductExpansion)
+/* (a*sqrt(b + c) + 1/(2*d) + sqrt(2)*a - 3)^4 gives the same result as the expansion of the product
+ * of four factors. */
+{
+    const BasePtr base = Sum::create({Product::create(a, Power::sqrt(Sum::create(b, c))),
+      Power::oneOver(Product::create(two, d)), Product::create(Power::sqrt(two), a), Numeric::create(-3)});
+    const BasePtr expected = expandAsProduct({base, base, base, base});
+
+    BOOST_CHECK_EQUAL(expected, Power::create(base, four)->expand());
+    BOOST_CHECK_EQUAL(Power::oneOver(expected), Power::create(base, Numeric::create(-4))->expand());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
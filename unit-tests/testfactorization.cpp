@@ -0,0 +1,175 @@
+
+#include <cmath>
+#include <vector>
+#include "boostmatrixvector.h"
+#include "functions.h"
+#include "solve.h"
+#include "tsymtests.h"
+
+using namespace tsym;
+
+struct FactorizationFixture {
+    const Var a{"a"};
+    const Var b{"b"};
+    const Var c{"c"};
+    const Var d{"d"};
+    const BoostMatrix A = createBoostMatrix({{0, a, 1}, {b, 0, 2}, {1, c, d}});
+
+    std::vector<Var> multiply(const std::vector<Var>& x) const
+    {
+        std::vector<Var> result(3, 0);
+
+        for (std::size_t i = 0; i < 3; ++i)
+            for (std::size_t j = 0; j < 3; ++j)
+                result[i] += A(i, j) * x[j];
+
+        return result;
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestFactorization, FactorizationFixture)
+
+BOOST_AUTO_TEST_CASE(permutationRecorded)
+{
+    const Factorization lu(A, BoostSizeType{3}, Algo::Gauss);
+    const std::vector<std::size_t> expected{1, 0, 2};
+
+    BOOST_CHECK_EQUAL(3, lu.dim());
+    BOOST_TEST(expected == lu.permutation(), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(solveManyRightHandSides)
+{
+    const std::vector<std::vector<Var>> solutions{{1, 2, 3}, {a, 0, b}, {c * d, -1, 1 / a}};
+    std::vector<std::vector<Var>> rhsColumns;
+
+    for (const auto& x : solutions)
+        rhsColumns.push_back(multiply(x));
+
+    for (const Algo choice : {Algo::Gauss, Algo::GaussLCPivot, Algo::Bareiss}) {
+        const Factorization lu(A, BoostSizeType{3}, choice);
+        const std::vector<std::vector<Var>> result = lu.solve(rhsColumns);
+
+        BOOST_REQUIRE_EQUAL(solutions.size(), result.size());
+
+        for (std::size_t i = 0; i < solutions.size(); ++i)
+            for (std::size_t j = 0; j < 3; ++j)
+                BOOST_CHECK_EQUAL(solutions[i][j], simplify(result[i][j]));
+
+        BOOST_CHECK_EQUAL(b, simplify(lu.solve(multiply({0, b, 0}))[1]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(determinant)
+{
+    const Var expected = expand(2 * a + b * c - a * b * d);
+
+    for (const Algo choice : {Algo::Gauss, Algo::GaussLCPivot, Algo::Bareiss})
+        BOOST_CHECK_EQUAL(expected, expand(Factorization(A, BoostSizeType{3}, choice).determinant()));
+}
+
+BOOST_AUTO_TEST_CASE(inverse)
+{
+    for (const Algo choice : {Algo::GaussLCPivot, Algo::Bareiss}) {
+        const std::vector<std::vector<Var>> inverse = Factorization(A, BoostSizeType{3}, choice).inverse();
+
+        BOOST_REQUIRE_EQUAL(3, inverse.size());
+
+        for (std::size_t i = 0; i < 3; ++i)
+            for (std::size_t j = 0; j < 3; ++j) {
+                Var entry(0);
+
+                for (std::size_t k = 0; k < 3; ++k)
+                    entry += A(i, k) * inverse[k][j];
+
+                BOOST_CHECK_EQUAL(i == j ? 1 : 0, simplify(entry));
+            }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(fromNestedStdVector)
+{
+    const std::vector<std::vector<Var>> B{{2, 1}, {4, 3}};
+    const Factorization lu(B, std::size_t{2});
+    const std::vector<Var> expected{1, 2};
+
+    BOOST_CHECK_EQUAL(2, lu.determinant());
+    BOOST_TEST(expected == lu.solve({4, 10}), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(numericHilbertInverse)
+/* The inverse of a Hilbert matrix has integer entries only, which requires exact arithmetic: */
+{
+    const std::size_t dim = 8;
+    const auto hilbert = [](std::size_t i, std::size_t j) { return Var(1, static_cast<int>(i + j + 1)); };
+    const Factorization lu(hilbert, dim);
+    const std::vector<std::vector<Var>> inverse = lu.inverse();
+
+    BOOST_CHECK_EQUAL(64, inverse[0][0]);
+    BOOST_CHECK_EQUAL(20160, inverse[0][2]);
+    BOOST_CHECK_EQUAL(Var("365356847125734485878112256000000"), 1 / lu.determinant());
+
+    for (std::size_t i = 0; i < dim; ++i)
+        for (std::size_t j = 0; j < dim; ++j) {
+            Var entry(0);
+
+            for (std::size_t k = 0; k < dim; ++k)
+                entry += hilbert(i, k) * inverse[k][j];
+
+            BOOST_CHECK_EQUAL(i == j ? 1 : 0, entry);
+        }
+}
+
+BOOST_AUTO_TEST_CASE(numericMatrixWithSymbolicRhs)
+{
+    const auto B = createBoostMatrix({{0, 2, 1}, {1, 1, 0}, {3, 0, Var(1, 2)}});
+    const Factorization lu(B, BoostSizeType{3});
+    const std::vector<Var> x = lu.solve({2 * b + c, a + b, 3 * a + c / 2});
+
+    BOOST_CHECK_EQUAL(-4, lu.determinant());
+    BOOST_CHECK_EQUAL(a, simplify(x[0]));
+    BOOST_CHECK_EQUAL(b, simplify(x[1]));
+    BOOST_CHECK_EQUAL(c, simplify(x[2]));
+}
+
+BOOST_AUTO_TEST_CASE(numericFloatingPointMatrix)
+/* Partial pivoting by magnitude is necessary here to keep the error small: */
+{
+    const auto B = createBoostMatrix({{1.e-17, 1.0}, {1.0, 1.0}});
+    const std::vector<Var> x = Factorization(B, BoostSizeType{2}).solve({1.0, 2.0});
+
+    BOOST_CHECK_CLOSE(1.0, static_cast<double>(x[0]), 1.e-10);
+    BOOST_CHECK_CLOSE(1.0, static_cast<double>(x[1]), 1.e-10);
+}
+
+BOOST_AUTO_TEST_CASE(numericPivotOfMixedColumn)
+/* The exact rational 3 must not stop the search for the largest magnitude: */
+{
+    const auto B = createBoostMatrix({{std::sqrt(0.2), 1, 0}, {3, 0, 1}, {100 * std::sqrt(2.0), 1, 1}});
+    const Factorization lu(B, BoostSizeType{3});
+
+    BOOST_CHECK_EQUAL(2, lu.permutation().front());
+}
+
+BOOST_AUTO_TEST_CASE(numericSingularMatrix)
+{
+    const auto singular = createBoostMatrix({{1, 2, 3}, {2, 4, 6}, {0, 1, 1}});
+    const Factorization lu(singular, BoostSizeType{3});
+
+    BOOST_CHECK_EQUAL(0, lu.determinant());
+    BOOST_CHECK_THROW(lu.solve({1, 2, 3}), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(singularMatrix)
+{
+    const auto singular = createBoostMatrix({{a, b}, {2 * a, 2 * b}});
+
+    for (const Algo choice : {Algo::GaussLCPivot, Algo::Bareiss}) {
+        const Factorization lu(singular, BoostSizeType{2}, choice);
+
+        BOOST_CHECK_EQUAL(0, lu.determinant());
+        BOOST_CHECK_THROW(lu.solve({a, b}), std::invalid_argument);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,6 +1,8 @@
 
 #include "basefct.h"
 #include "fixtures.h"
+#include "heuristicgcd.h"
+#include "modulargcd.h"
 #include "numeric.h"
 #include "poly.h"
 #include "power.h"
@@ -21,6 +23,8 @@ struct GcdFixture : public AbcFixture {
     {
         checkPrimitive(expected, u, v);
         checkSubresultant(expected, u, v);
+        checkModular(expected, u, v);
+        checkHeuristic(expected, u, v);
     }
 
     void checkPrimitive(const BasePtr& expected, const BasePtr& u, const BasePtr& v)
@@ -37,6 +41,20 @@ struct GcdFixture : public AbcFixture {
         check(srGcd, expected, u, v);
     }
 
+    void checkModular(const BasePtr& expected, const BasePtr& u, const BasePtr& v)
+    {
+        ModularGcd modGcd;
+
+        check(modGcd, expected, u, v);
+    }
+
+    void checkHeuristic(const BasePtr& expected, const BasePtr& u, const BasePtr& v)
+    {
+        HeuristicGcd heuGcd;
+
+        check(heuGcd, expected, u, v);
+    }
+
     void check(Gcd& gcd, const BasePtr& expected, const BasePtr& u, const BasePtr& v)
     {
         const BasePtr result = poly::gcd(u, v, gcd);
@@ -368,4 +386,74 @@ BOOST_AUTO_TEST_CASE(largeMultivarPoly, *label("expensive"))
     check(gcd, u, v);
 }
 
+BOOST_AUTO_TEST_CASE(largeCoefficients)
+/* The coefficients exceed the size of a single prime used by the modular algorithm: */
+{
+    const BasePtr large = Numeric::create(Int("123456789012345678901234567"));
+    const BasePtr gcd = Sum::create(Product::create(large, a, b), Product::create(seven, c), one);
+    const BasePtr u = Product::create(gcd, Sum::create(Product::create(large, a), b))->expand();
+    const BasePtr v = Product::create(gcd, Sum::create(Power::create(b, two), Product::create(three, c)))->expand();
+
+    check(gcd, u, v);
+}
+
+BOOST_AUTO_TEST_CASE(unluckyEvaluationPoints)
+/* Evaluation of (a + b*c)*(a + 1) and (a + b*c)*(a + b) at b = 1 yields an additional common
+ * factor, which must be detected by the modular algorithm. */
+{
+    const BasePtr gcd = Sum::create(a, Product::create(b, c));
+    const BasePtr u = Product::create(gcd, Sum::create(a, one))->expand();
+    const BasePtr v = Product::create(gcd, Sum::create(a, b))->expand();
+
+    check(gcd, u, v);
+}
+
+BOOST_AUTO_TEST_CASE(coprimeWithCommonSymbols)
+/* gcd(6*a*b + 6*c, 4*a + 4*b*c) = 2, detected by the coprimality check. */
+{
+    const BasePtr u = Sum::create(Product::create(six, a, b), Product::create(six, c));
+    const BasePtr v = Sum::create(Product::create(four, a), Product::create(four, b, c));
+
+    check(two, u, v);
+}
+
+BOOST_AUTO_TEST_CASE(contentInOneVariableOnly)
+/* The gcd b doesn't depend on a, but isn't constant: */
+{
+    const BasePtr u = Sum::create(Product::create(a, b), b);
+    const BasePtr v = Sum::create(Product::create(a, b), Product::create(two, b));
+
+    check(b, u, v);
+}
+
+BOOST_AUTO_TEST_CASE(leadingCoeffDivisibleByPrime)
+/* The leading coefficient in a is a multiple of the prime used by the coprimality check: */
+{
+    const BasePtr largePrime = Numeric::create(2147483647);
+    const BasePtr gcd = Sum::create(Product::create(largePrime, a), b);
+    const BasePtr u = Product::create(gcd, Sum::create(a, c))->expand();
+    const BasePtr v = Product::create(gcd, Sum::create(a, Product::create(two, c), one))->expand();
+
+    check(gcd, u, v);
+}
+
+BOOST_AUTO_TEST_CASE(heuristicStatistics)
+{
+    const BasePtr u = Product::create(a, Sum::create(b, two))->expand();
+    const BasePtr v = Product::create(a, Sum::create(b, three))->expand();
+    const BasePtr w = Product::create(Numeric::third(), a, b);
+    HeuristicGcd heuGcd;
+
+    HeuristicGcd::resetStatistics();
+
+    BOOST_CHECK_EQUAL(a, poly::gcd(u, v, heuGcd));
+    BOOST_CHECK_EQUAL(1, HeuristicGcd::statistics().successes);
+    BOOST_CHECK_EQUAL(0, HeuristicGcd::statistics().fallbacks);
+
+    /* Non-integer coefficients are passed on to the fallback algorithm: */
+    poly::gcd(w, u, heuGcd);
+    BOOST_CHECK_EQUAL(1, HeuristicGcd::statistics().successes);
+    BOOST_CHECK_EQUAL(1, HeuristicGcd::statistics().fallbacks);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,116 @@
+
+#include <cmath>
+#include <limits>
+#include "constant.h"
+#include "fixtures.h"
+#include "interval.h"
+#include "logarithm.h"
+#include "numeric.h"
+#include "power.h"
+#include "product.h"
+#include "sum.h"
+#include "symbol.h"
+#include "trigonometric.h"
+#include "tsymtests.h"
+
+using namespace tsym;
+
+struct IntervalFixture : public AbcFixture {
+    const BasePtr aPos = Symbol::createPositive("a");
+    const double inf = std::numeric_limits<double>::infinity();
+};
+
+namespace {
+    bool encloses(const Interval& interval, double value)
+    {
+        return interval.lower < value && value < interval.upper;
+    }
+
+    bool isTight(const Interval& interval, double value)
+    {
+        return encloses(interval, value) && interval.upper - interval.lower < 1.e-12 * (1.0 + std::abs(value));
+    }
+}
+
+BOOST_FIXTURE_TEST_SUITE(TestInterval, IntervalFixture)
+
+BOOST_AUTO_TEST_CASE(numericIsEnclosed)
+{
+    const Interval result = enclosure(*Numeric::create(1, 3));
+
+    BOOST_TEST(isTight(result, 1.0 / 3.0));
+    BOOST_TEST(result.lower < result.upper);
+}
+
+BOOST_AUTO_TEST_CASE(piIsEnclosed)
+{
+    BOOST_TEST(isTight(enclosure(*pi), M_PI));
+}
+
+BOOST_AUTO_TEST_CASE(symbols)
+{
+    const Interval unbounded = enclosure(*a);
+    const Interval positive = enclosure(*aPos);
+
+    BOOST_CHECK_EQUAL(-inf, unbounded.lower);
+    BOOST_CHECK_EQUAL(inf, unbounded.upper);
+    BOOST_CHECK_EQUAL(0.0, positive.lower);
+    BOOST_CHECK_EQUAL(inf, positive.upper);
+}
+
+BOOST_AUTO_TEST_CASE(numericExpression)
+{
+    const BasePtr expr = Sum::create(Product::create(Power::sqrt(two), pi), Logarithm::create(three));
+    const Interval result = enclosure(*expr);
+
+    BOOST_TEST(isTight(result, std::sqrt(2.0) * M_PI + std::log(3.0)));
+}
+
+BOOST_AUTO_TEST_CASE(evenPowerOfUnboundedSymbol)
+{
+    const Interval result = enclosure(*Sum::create(Power::create(a, two), one));
+
+    BOOST_TEST(result.lower > 0.99);
+    BOOST_CHECK_EQUAL(inf, result.upper);
+}
+
+BOOST_AUTO_TEST_CASE(reciprocalOfPositiveSum)
+{
+    const Interval result = enclosure(*Power::oneOver(Sum::create(aPos, two)));
+
+    BOOST_TEST(result.lower <= 0.0);
+    BOOST_TEST(result.upper > 0.5);
+    BOOST_TEST(result.upper < 0.5 + 1.e-12);
+}
+
+BOOST_AUTO_TEST_CASE(reciprocalOfIntervalContainingZero)
+{
+    const Interval result = enclosure(*Power::oneOver(Sum::create(a, two)));
+
+    BOOST_CHECK_EQUAL(-inf, result.lower);
+    BOOST_CHECK_EQUAL(inf, result.upper);
+}
+
+BOOST_AUTO_TEST_CASE(boundedFunctions)
+{
+    const Interval sin = enclosure(*Trigonometric::createSin(a));
+    const Interval atan = enclosure(*Trigonometric::createAtan(a));
+    const Interval acos = enclosure(*Trigonometric::createAcos(a));
+
+    BOOST_CHECK_EQUAL(-1.0, sin.lower);
+    BOOST_CHECK_EQUAL(1.0, sin.upper);
+    BOOST_TEST(encloses(atan, M_PI / 2.0 - 1.e-10));
+    BOOST_TEST(atan.upper < M_PI / 2.0 + 1.e-10);
+    BOOST_TEST(encloses(acos, 0.0));
+    BOOST_TEST(encloses(acos, M_PI));
+}
+
+BOOST_AUTO_TEST_CASE(signOfInterval)
+{
+    BOOST_CHECK_EQUAL(1, sign(Interval{1.e-300, 1.0}));
+    BOOST_CHECK_EQUAL(-1, sign(Interval{-inf, -1.0}));
+    BOOST_CHECK_EQUAL(0, sign(Interval{0.0, 1.0}));
+    BOOST_CHECK_EQUAL(0, sign(Interval{-1.0, inf}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,113 @@
+
+#include <vector>
+#include "functions.h"
+#include "sparse.h"
+#include "tsymtests.h"
+
+using namespace tsym;
+
+struct JacobianFixture {
+    const Var a{"a"};
+    const Var b{"b"};
+    const Var c{"c"};
+    const Var d{"d"};
+    const std::vector<Var> symbols{a, b, c, d};
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestJacobian, JacobianFixture)
+
+BOOST_AUTO_TEST_CASE(emptyInput)
+{
+    const CsrMatrix result = jacobian({}, symbols);
+
+    BOOST_CHECK_EQUAL(0, result.pattern.nRows);
+    BOOST_CHECK_EQUAL(4, result.pattern.nColumns);
+    BOOST_CHECK_EQUAL(1, result.pattern.rowPointers.size());
+    BOOST_TEST(result.values.empty());
+}
+
+BOOST_AUTO_TEST_CASE(patternOfSimpleFunctions)
+{
+    const std::vector<Var> functions{a * b, 2 + c, tsym::sin(d * a), 10};
+    const std::vector<std::size_t> expectedRowPointers{0, 2, 3, 5, 5};
+    const std::vector<std::size_t> expectedColumns{0, 1, 2, 0, 3};
+    const SparsityPattern pattern = jacobianPattern(functions, symbols);
+
+    BOOST_CHECK_EQUAL(4, pattern.nRows);
+    BOOST_CHECK_EQUAL(4, pattern.nColumns);
+    BOOST_TEST(expectedRowPointers == pattern.rowPointers, per_element());
+    BOOST_TEST(expectedColumns == pattern.columnIndices, per_element());
+}
+
+BOOST_AUTO_TEST_CASE(patternIgnoresSymbolsNotRequested)
+{
+    const SparsityPattern pattern = jacobianPattern({a * b * c}, {d, b});
+    const std::vector<std::size_t> expectedColumns{1};
+
+    BOOST_TEST(expectedColumns == pattern.columnIndices, per_element());
+}
+
+BOOST_AUTO_TEST_CASE(positiveSymbolDiffersFromNonPositive)
+{
+    const Var aPos("a", Var::Sign::POSITIVE);
+    const SparsityPattern pattern = jacobianPattern({aPos * b}, {a, aPos});
+    const std::vector<std::size_t> expectedColumns{1};
+
+    BOOST_TEST(expectedColumns == pattern.columnIndices, per_element());
+}
+
+BOOST_AUTO_TEST_CASE(jacobianValues)
+{
+    const std::vector<Var> functions{a * b, b * b + c, tsym::sin(d)};
+    const std::vector<std::size_t> expectedRowPointers{0, 2, 4, 5};
+    const std::vector<std::size_t> expectedColumns{0, 1, 1, 2, 3};
+    const std::vector<Var> expectedValues{b, a, 2 * b, 1, tsym::cos(d)};
+    const CsrMatrix result = jacobian(functions, symbols);
+
+    BOOST_TEST(expectedRowPointers == result.pattern.rowPointers, per_element());
+    BOOST_TEST(expectedColumns == result.pattern.columnIndices, per_element());
+    BOOST_TEST(expectedValues == result.values, per_element());
+}
+
+BOOST_AUTO_TEST_CASE(vanishingDerivativeIsDropped)
+{
+    const Var zeroDerivative = tsym::pow(tsym::sin(a), 2) + tsym::pow(tsym::cos(a), 2) + b;
+    const CsrMatrix result = jacobian({zeroDerivative}, {a, b});
+    const std::vector<std::size_t> expectedColumns{1};
+
+    BOOST_TEST(expectedColumns == result.pattern.columnIndices, per_element());
+    BOOST_CHECK_EQUAL(1, result.values.front());
+}
+
+BOOST_AUTO_TEST_CASE(matchesDenseDifferentiation)
+{
+    const std::vector<Var> functions{a * tsym::pow(b, c) + d, tsym::log(a * c) / b, tsym::atan2(d, a)};
+    const CsrMatrix result = jacobian(functions, symbols);
+
+    for (std::size_t i = 0; i < functions.size(); ++i)
+        for (std::size_t k = result.pattern.rowPointers[i]; k < result.pattern.rowPointers[i + 1]; ++k) {
+            const std::size_t j = result.pattern.columnIndices[k];
+
+            BOOST_CHECK_EQUAL(diff(functions[i], symbols[j]), result.values[k]);
+        }
+}
+
+BOOST_AUTO_TEST_CASE(columnColoring)
+{
+    const std::vector<Var> functions{a + b, c, c + d, a};
+    const SparsityPattern pattern = jacobianPattern(functions, symbols);
+    const std::vector<std::size_t> expected{0, 1, 0, 1};
+    const auto colors = colorColumns(pattern);
+
+    BOOST_TEST(expected == colors, per_element());
+}
+
+BOOST_AUTO_TEST_CASE(coloringOfDiagonalPattern)
+{
+    const SparsityPattern pattern = jacobianPattern(symbols, symbols);
+    const std::vector<std::size_t> expected(4, 0);
+
+    BOOST_TEST(expected == colorColumns(pattern), per_element());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
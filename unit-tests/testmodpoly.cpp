@@ -0,0 +1,127 @@
+
+#include "fixtures.h"
+#include "modpoly.h"
+#include "numeric.h"
+#include "power.h"
+#include "product.h"
+#include "sum.h"
+#include "tsymtests.h"
+
+using namespace tsym;
+
+struct ModPolyFixture : public AbcFixture {
+    const BasePtrList variables{a, b};
+    const std::uint64_t p = 7;
+
+    ModPoly modPoly(const BasePtr& arg) const
+    {
+        const auto sparse = SparsePoly::fromBase(*arg, variables);
+
+        BOOST_REQUIRE(sparse);
+
+        return ModPoly(*sparse, p);
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestModPoly, ModPolyFixture)
+
+BOOST_AUTO_TEST_CASE(reduction)
+{
+    BOOST_CHECK_EQUAL(3, modp::reduce(Int(10), p));
+    BOOST_CHECK_EQUAL(4, modp::reduce(Int(-10), p));
+    BOOST_CHECK_EQUAL(0, modp::reduce(Int(-14), p));
+}
+
+BOOST_AUTO_TEST_CASE(inverse)
+{
+    for (std::uint64_t n = 1; n < p; ++n)
+        BOOST_CHECK_EQUAL(1, n * modp::inverse(n, p) % p);
+}
+
+BOOST_AUTO_TEST_CASE(primes)
+{
+    BOOST_TEST(modp::isPrime(2));
+    BOOST_TEST(modp::isPrime(2147483647));
+    BOOST_TEST(!modp::isPrime(1));
+    BOOST_TEST(!modp::isPrime(91));
+
+    BOOST_CHECK_EQUAL(89, modp::previousPrime(97));
+    BOOST_CHECK_EQUAL(2147483629, modp::previousPrime(2147483647));
+}
+
+BOOST_AUTO_TEST_CASE(coefficientsReducedOnConversion)
+/* 9*a^2 - 7*b - 1 mod 7 = 2*a^2 + 6: */
+{
+    const ModPoly u = modPoly(Sum::create(Product::create(nine, a, a), Product::minus(seven, b), Numeric::mOne()));
+
+    BOOST_CHECK_EQUAL(2, u.terms().size());
+    BOOST_CHECK_EQUAL(2, u.leadingCoeff());
+    BOOST_CHECK_EQUAL(2, u.degree(0));
+    BOOST_CHECK_EQUAL(0, u.degree(1));
+}
+
+BOOST_AUTO_TEST_CASE(symmetricRepresentation)
+{
+    const BasePtr u = Sum::create(Product::create(three, a), Numeric::create(-2), b);
+
+    BOOST_CHECK_EQUAL(u, modPoly(u).toSparse().toBase(variables));
+}
+
+BOOST_AUTO_TEST_CASE(arithmetic)
+{
+    const BasePtr u = Sum::create(a, Product::create(four, b));
+    const BasePtr v = Sum::create(Product::create(six, a), b, two);
+    const BasePtr product = Product::create(u, v)->expand();
+
+    BOOST_TEST((modPoly(product) == modPoly(u) * modPoly(v)));
+    BOOST_TEST((modPoly(Sum::create(u, v)) == modPoly(u) + modPoly(v)));
+    BOOST_TEST((modPoly(Numeric::zero()) == modPoly(u) - modPoly(u)));
+    BOOST_TEST(modPoly(Sum::create(u, Product::minus(u))).isZero());
+}
+
+BOOST_AUTO_TEST_CASE(evaluation)
+/* a^2*b + 3*b + 1 at b = 2 is 2*a^2 + 7 = 2*a^2 mod 7: */
+{
+    const BasePtr u = Sum::create(Product::create(Power::create(a, two), b), Product::create(three, b), one);
+    const ModPoly expected = modPoly(Product::create(two, Power::create(a, two)));
+
+    BOOST_TEST((expected == modPoly(u).evaluate(1, 2)));
+}
+
+BOOST_AUTO_TEST_CASE(exactDivision)
+{
+    const BasePtr u = Sum::create(a, Product::create(three, b));
+    const BasePtr v = Sum::create(Product::create(a, b), five);
+    const auto [quotient, remainder] = modp::divide(modPoly(Product::create(u, v)->expand()), modPoly(v));
+
+    BOOST_TEST(remainder.isZero());
+    BOOST_TEST((modPoly(u) == quotient));
+}
+
+BOOST_AUTO_TEST_CASE(nonZeroRemainder)
+{
+    const auto [quotient, remainder] = modp::divide(modPoly(Power::create(a, two)), modPoly(Sum::create(a, b)));
+
+    BOOST_TEST(!remainder.isZero());
+}
+
+BOOST_AUTO_TEST_CASE(univariateGcd)
+/* (a + 2)*(a - 3) and (a + 2)*(3*a + 1) have the monic gcd a + 2: */
+{
+    const BasePtr gcd = Sum::create(a, two);
+    const BasePtr u = Product::create(gcd, Sum::create(a, Numeric::create(-3)))->expand();
+    const BasePtr v = Product::create(gcd, Sum::create(Product::create(three, a), one))->expand();
+
+    BOOST_TEST((modPoly(gcd) == modp::gcd(modPoly(u), modPoly(v))));
+}
+
+BOOST_AUTO_TEST_CASE(univariateGcdCoprimeModP)
+/* a + 1 and a + 8 are coprime over the integers, but equal modulo 7: */
+{
+    const ModPoly expected = modPoly(Sum::create(a, one));
+    const ModPoly result = modp::gcd(modPoly(Sum::create(a, one)), modPoly(Sum::create(a, eight)));
+
+    BOOST_TEST((expected == result));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,110 @@
+
+#include <cmath>
+#include "constant.h"
+#include "fixtures.h"
+#include "logarithm.h"
+#include "numeric.h"
+#include "numericeval.h"
+#include "power.h"
+#include "product.h"
+#include "sum.h"
+#include "trigonometric.h"
+#include "tsymtests.h"
+#include "undefined.h"
+
+using namespace tsym;
+
+struct NumericEvalFixture : public AbcFixture {
+    const NumberBindings bindings{{a, 2}, {b, Number(1, 3)}, {c, -0.5}};
+    const double TOL = 1.e-10;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestNumericEval, NumericEvalFixture)
+
+BOOST_AUTO_TEST_CASE(numericLeaf)
+{
+    BOOST_CHECK_EQUAL(Number(3, 4), numericEval(*Numeric::create(3, 4), {}));
+}
+
+BOOST_AUTO_TEST_CASE(boundSymbol)
+{
+    BOOST_CHECK_EQUAL(2, numericEval(*a, bindings));
+}
+
+BOOST_AUTO_TEST_CASE(unboundSymbol)
+{
+    BOOST_TEST(!numericEval(*d, bindings));
+    BOOST_TEST(!numericEval(*Sum::create(a, d), bindings));
+}
+
+BOOST_AUTO_TEST_CASE(rationalSumAndProductStayExact)
+{
+    const BasePtr expr = Sum::create(Product::create(a, b), Power::create(b, two), one);
+    const auto result = numericEval(*expr, bindings);
+
+    BOOST_TEST(result->isRational());
+    BOOST_CHECK_EQUAL(Number(16, 9), *result);
+}
+
+BOOST_AUTO_TEST_CASE(doubleLeafGivesDouble)
+{
+    const double value = std::sqrt(2.0);
+    const auto result = numericEval(*Product::create(a, Sum::create(b, d)), {{a, 2}, {b, Number(1, 3)}, {d, value}});
+
+    BOOST_TEST(result->isDouble());
+    BOOST_CHECK_CLOSE(2.0 * (1.0 / 3.0 + value), result->toDouble(), TOL);
+}
+
+BOOST_AUTO_TEST_CASE(powerWithTooLargeExponent)
+{
+    const BasePtr expr = Power::create(a, b);
+
+    BOOST_TEST(!numericEval(*expr, {{a, 2}, {b, Number(Int(5000000000))}}));
+    BOOST_TEST(!numericEval(*expr, {{a, 2}, {b, Number(Int(-5000000000))}}));
+    BOOST_TEST(!numericEval(*expr, {{a, 2}, {b, Number(1, Int(5000000000))}}));
+}
+
+BOOST_AUTO_TEST_CASE(powerWithFractionExponent)
+{
+    const auto result = numericEval(*Power::sqrt(a), bindings);
+
+    BOOST_CHECK_CLOSE(std::sqrt(2.0), result->toDouble(), TOL);
+}
+
+BOOST_AUTO_TEST_CASE(functionsAndConstants)
+{
+    const BasePtr expr = Sum::create(Trigonometric::createSin(Product::create(pi, b)),
+      Logarithm::create(a), Trigonometric::createAtan2(c, a));
+    const double expected = std::sin(M_PI / 3.0) + std::log(2.0) + std::atan2(-0.5, 2.0);
+
+    BOOST_CHECK_CLOSE(expected, numericEval(*expr, bindings)->toDouble(), TOL);
+}
+
+BOOST_AUTO_TEST_CASE(sameResultAsSubstitution)
+{
+    const BasePtr expr = Product::create(Power::create(Sum::create(a, c), Numeric::create(3, 2)),
+      Trigonometric::createCos(b), Logarithm::create(Sum::create(a, b)));
+    const BasePtr substituted = expr->subst({{a, two}, {b, Numeric::create(1, 3)}, {c, Numeric::create(-0.5)}});
+
+    BOOST_CHECK_CLOSE(substituted->numericEval()->toDouble(), numericEval(*expr, bindings)->toDouble(), TOL);
+}
+
+BOOST_AUTO_TEST_CASE(divisionByZero)
+{
+    const BasePtr expr = Power::oneOver(Sum::create(a, Product::minus(two)));
+
+    BOOST_TEST(!numericEval(*expr, bindings));
+}
+
+BOOST_AUTO_TEST_CASE(functionArgumentOutOfDomain)
+{
+    BOOST_TEST(!numericEval(*Trigonometric::createAsin(a), bindings));
+    BOOST_TEST(!numericEval(*Logarithm::create(Sum::create(a, d)), {{a, -1}, {d, 1}}));
+}
+
+BOOST_AUTO_TEST_CASE(undefinedExpression)
+{
+    BOOST_TEST(!numericEval(*undefined, bindings));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
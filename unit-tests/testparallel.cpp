@@ -0,0 +1,72 @@
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include "functions.h"
+#include "parallel.h"
+#include "tsymtests.h"
+
+using namespace tsym;
+
+BOOST_AUTO_TEST_SUITE(TestParallel)
+
+BOOST_AUTO_TEST_CASE(eachIndexProcessedOnce)
+{
+    const std::size_t n = 1000;
+    std::vector<std::atomic<int>> counts(n);
+
+    parallelFor(n, 4, [&counts](std::size_t i) { ++counts[i]; });
+
+    for (const auto& count : counts)
+        BOOST_CHECK_EQUAL(1, count.load());
+}
+
+BOOST_AUTO_TEST_CASE(zeroItems)
+{
+    std::atomic<int> count{0};
+
+    parallelFor(0, 4, [&count](std::size_t) { ++count; });
+
+    BOOST_CHECK_EQUAL(0, count.load());
+}
+
+BOOST_AUTO_TEST_CASE(exceptionIsRethrown)
+{
+    const auto fct = [](std::size_t i) {
+        if (i == 50)
+            throw std::invalid_argument("Fiftieth item");
+    };
+
+    BOOST_CHECK_THROW(parallelFor(100, 4, fct), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(nestedCall)
+{
+    std::atomic<int> count{0};
+
+    parallelFor(8, 4, [&count](std::size_t) { parallelFor(8, 4, [&count](std::size_t) { ++count; }); });
+
+    BOOST_CHECK_EQUAL(64, count.load());
+}
+
+BOOST_AUTO_TEST_CASE(simplificationOnMultipleThreads)
+{
+    const Var a("a");
+    const Var b("b");
+    const std::size_t n = 32;
+    std::vector<Var> result(n);
+
+    parallelFor(n, 4, [&](std::size_t i) {
+        const int k = static_cast<int>(i);
+
+        result[i] = simplify((a * a - k * k * b * b) / (a + k * b) + tsym::pow(a + k, 2) / (a + k));
+    });
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const int k = static_cast<int>(i);
+
+        BOOST_CHECK_EQUAL(2 * a - k * b + k, result[i]);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
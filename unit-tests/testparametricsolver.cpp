@@ -0,0 +1,90 @@
+#include <vector>
+#include "boostmatrixvector.h"
+#include "solve.h"
+#include "tsymtests.h"
+
+using namespace tsym;
+
+struct ParametricSolverFixture {
+    const Var a{"a"};
+    const Var b{"b"};
+    const Var c{"c"};
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestParametricSolver, ParametricSolverFixture)
+
+BOOST_AUTO_TEST_CASE(polynomialSystemDim3)
+{
+    const BoostMatrix A = createBoostMatrix({{a, b, 1}, {a * a, c, 1}, {1, a + b, c}});
+    const std::vector<Var> rhs{a + 2 * b + 3, a * a + 2 * c + 3, 1 + 2 * a + 2 * b + 3 * c};
+    const std::vector<std::vector<Var>> values{{1, 2, 3}, {Var(1, 2), -4, 7}, {-3, 0, Var(2, 3)}};
+    const std::vector<Var> expected{1, 2, 3};
+
+    for (const Algo algo : {Algo::GaussLCPivot, Algo::Bareiss}) {
+        const ParametricSolver solver(A, BoostSizeType{3}, {a, b, c}, algo);
+        const std::vector<std::vector<Var>> result = solver.solve(rhs, values);
+
+        BOOST_CHECK_EQUAL(3, solver.dim());
+        BOOST_REQUIRE_EQUAL(values.size(), result.size());
+
+        for (const auto& x : result)
+            BOOST_TEST(expected == x, boost::test_tools::per_element());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(floatingPointValues)
+{
+    const BoostMatrix A = createBoostMatrix({{a, 1}, {2, b}});
+    const ParametricSolver solver(A, BoostSizeType{2}, {a, b});
+    const std::vector<Var> x = solver.solve({1, a}, {{0.5, 3.0}}).front();
+
+    BOOST_CHECK_CLOSE(-5.0, static_cast<double>(x[0]), 1.e-10);
+    BOOST_CHECK_CLOSE(3.5, static_cast<double>(x[1]), 1.e-10);
+}
+
+BOOST_AUTO_TEST_CASE(parallelBatch)
+{
+    const BoostMatrix A = createBoostMatrix({{a, 1}, {1, b}});
+    std::vector<std::vector<Var>> values;
+    SolveOptions options;
+
+    options.nThreads = 4;
+
+    for (int i = 2; i < 34; ++i)
+        values.push_back({i, i + 1});
+
+    const ParametricSolver solver(A, BoostSizeType{2}, {a, b}, options);
+    const std::vector<std::vector<Var>> result = solver.solve({a + 1, 1 + b}, values);
+
+    for (const auto& x : result)
+        BOOST_TEST((x == std::vector<Var>{1, 1}));
+}
+
+BOOST_AUTO_TEST_CASE(zeroOnDiagonal)
+{
+    const BoostMatrix A = createBoostMatrix({{a, 1}, {1, 1}});
+    const ParametricSolver solver(A, BoostSizeType{2}, {a}, Algo::Gauss);
+    const std::vector<std::vector<Var>> result = solver.solve({1, 2}, {{0}, {2}});
+
+    BOOST_TEST((result[0] == std::vector<Var>{1, 1}));
+    BOOST_TEST((result[1] == std::vector<Var>{-1, 3}));
+}
+
+BOOST_AUTO_TEST_CASE(symbolicValue)
+{
+    const BoostMatrix A = createBoostMatrix({{a, 1}, {1, 1}});
+    const ParametricSolver solver(A, BoostSizeType{2}, {a});
+    const std::vector<std::vector<Var>> result = solver.solve({c + 1, 2}, {{c}});
+
+    BOOST_TEST((result.front() == std::vector<Var>{1, 1}));
+}
+
+BOOST_AUTO_TEST_CASE(singularInstance)
+{
+    const BoostMatrix A = createBoostMatrix({{a, 1}, {1, 1}});
+    const ParametricSolver solver(A, BoostSizeType{2}, {a});
+
+    BOOST_CHECK_THROW(solver.solve({1, 2}, {{2}, {1}}), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -2,6 +2,7 @@
 #include <vector>
 #include "boostmatrixvector.h"
 #include "directsolve.h"
+#include "functions.h"
 #include "stdvecwrapper.h"
 #include "tsymtests.h"
 #include "var.h"
@@ -47,6 +48,22 @@ BOOST_AUTO_TEST_CASE(numericPivotingDim3)
     BOOST_CHECK_EQUAL(1, rowSwaps);
 }
 
+BOOST_AUTO_TEST_CASE(pivotZeroButNotSimplified)
+/* The first diagonal element is zero, but not in its simplest form: */
+{
+    const Var zero = tsym::pow(a + 1, 2) - a * a - 2 * a - 1;
+    const SquareMatrixAdaptor<> orig{{zero, 1, a, b}, 2};
+    OptVector rhs;
+
+    auto m = orig;
+
+    BOOST_CHECK_EQUAL(1, eliminateGauss(m, rhs, &firstNonZeroPivot));
+
+    m = orig;
+
+    BOOST_CHECK_EQUAL(1, eliminateGauss(m, rhs, &leastComplexityPivot));
+}
+
 BOOST_AUTO_TEST_CASE(zeroLastRowDim3)
 {
     const SquareMatrixAdaptor<> orig{{0, 1, a, b, 0, 2, a, Var(-1, 2), 0}, 3};
@@ -686,6 +686,79 @@ BOOST_AUTO_TEST_CASE(detDim7SkipField)
     BOOST_CHECK_EQUAL(expected, det);
 }
 
+BOOST_AUTO_TEST_CASE(divisionFreeDetDim0)
+{
+    const BoostSizeType dim(0);
+    BoostMatrix A(dim, dim);
+
+    BOOST_CHECK_EQUAL(1, determinant(A, dim, Algo::Berkowitz));
+    BOOST_CHECK_EQUAL(1, determinant(A, dim, Algo::Laplace));
+}
+
+BOOST_AUTO_TEST_CASE(divisionFreeDetDim4)
+{
+    auto A = createBoostMatrix({{0, 1, a, 3}, {b, 0, 2, 0}, {a, Var(-1, 2), 0, 2}, {0, b, 3, 0}});
+    const Var expected(-6 * a * b - 2 * a * b * b + 21 * b / 2);
+
+    BOOST_CHECK_EQUAL(expected, determinant(A, BoostSizeType{4}, Algo::Berkowitz));
+    BOOST_CHECK_EQUAL(expected, determinant(A, BoostSizeType{4}, Algo::Laplace));
+}
+
+BOOST_AUTO_TEST_CASE(divisionFreeDetOfPolynomialMatrixDim5)
+{
+    BoostMatrix A(5, 5);
+
+    for (std::size_t i = 0; i < 5; ++i)
+        for (std::size_t j = 0; j < 5; ++j)
+            A(i, j) = (i + j) % 3 == 0 ? a + static_cast<int>(i)
+                                       : b * static_cast<int>(j) - c + static_cast<int>(i * j % 4);
+
+    const Var berkowitz = determinant(A, BoostSizeType{5}, Algo::Berkowitz);
+    const Var laplace = determinant(A, BoostSizeType{5}, Algo::Laplace);
+
+    BOOST_CHECK_EQUAL(berkowitz, laplace);
+    BOOST_CHECK_EQUAL(berkowitz, expand(determinant(A, BoostSizeType{5}, Algo::Bareiss)));
+}
+
+BOOST_AUTO_TEST_CASE(divisionFreeDetOfSingularMatrix)
+{
+    auto A = createBoostMatrix({{a, b, 1}, {2 * a, 2 * b, 2}, {c, d, 1}});
+
+    BOOST_CHECK_EQUAL(0, determinant(A, A.size1(), Algo::Berkowitz));
+    BOOST_CHECK_EQUAL(0, determinant(A, A.size1(), Algo::Laplace));
+}
+
+BOOST_AUTO_TEST_CASE(solveWithDeterminantOnlyAlgo)
+{
+    auto A = createBoostMatrix({{a, b}, {c, d}});
+    auto rhs = createBoostVector({a + b, c + d});
+    auto x = createBoostVector({0, 0});
+
+    solve(A, rhs, x, x.size(), Algo::Berkowitz);
+
+    BOOST_CHECK_EQUAL(1, x(0));
+    BOOST_CHECK_EQUAL(1, x(1));
+}
+
+BOOST_AUTO_TEST_CASE(characteristicPolynomialDim2)
+{
+    const Var x("x");
+    auto A = createBoostMatrix({{a, b}, {c, d}});
+    const Var expected = expand(x * x - (a + d) * x + a * d - b * c);
+
+    BOOST_CHECK_EQUAL(expected, characteristicPolynomial(A, x, A.size1()));
+}
+
+BOOST_AUTO_TEST_CASE(characteristicPolynomialOfCompanionMatrix)
+/* The companion matrix of x^3 + a*x^2 + b*x + c: */
+{
+    const Var x("x");
+    auto A = createBoostMatrix({{0, 0, -c}, {1, 0, -b}, {0, 1, -a}});
+    const Var expected = tsym::pow(x, 3) + a * x * x + b * x + c;
+
+    BOOST_CHECK_EQUAL(expected, characteristicPolynomial(A, x, A.size1()));
+}
+
 BOOST_AUTO_TEST_CASE(inverseDim2)
 {
     auto A = createBoostMatrix({{a, b}, {c, d}});
@@ -709,6 +782,34 @@ BOOST_AUTO_TEST_CASE(inverseDim2SpecifyAccess)
     BOOST_TEST(expected == A, boost::test_tools::per_element{});
 }
 
+BOOST_AUTO_TEST_CASE(inverseDim3SkipFieldWithOptions)
+{
+    const Var det = a * d - b * c;
+    std::vector<std::vector<Var>> A{{a, e, b}, {e, e, e}, {c, e, d}};
+    const std::vector<std::vector<Var>> expected{{d / det, e, -b / det}, {e, e, e}, {-c / det, e, 1 / (d - b * c / a)}};
+    const std::vector<bool> skipField{false, true, false};
+    SolveOptions options(Algo::Gauss);
+
+    options.nThreads = 2;
+
+    invert(A, skipField, A.size(), options);
+
+    BOOST_TEST((expected == A));
+}
+
+BOOST_AUTO_TEST_CASE(solveWithReadOnlyAccess)
+{
+    const std::vector<Var> entries{a, b, c, d};
+    const auto A = [&entries](std::size_t i, std::size_t j) { return entries[i * 2 + j]; };
+    const auto rhs = [this](std::size_t i) { return i == 0 ? a + b : c + d; };
+    std::vector<Var> x(2);
+
+    solve(A, rhs, x, std::size_t{2});
+
+    BOOST_CHECK_EQUAL(1, x[0]);
+    BOOST_CHECK_EQUAL(1, x[1]);
+}
+
 BOOST_AUTO_TEST_CASE(numericInverseDim3)
 {
     auto A = createBoostMatrix({{1, 2, 3}, {2, 1, 0}, {3, -1, -4}});
@@ -883,6 +984,183 @@ BOOST_AUTO_TEST_CASE(inverseDim15, *label("expensive"))
             BOOST_CHECK_CLOSE(static_cast<double>(expected[i][j]), static_cast<double>(A[i][j]), TOL);
 }
 
+BOOST_AUTO_TEST_CASE(bareissSolveLinearSystemDim3)
+{
+    auto A = createBoostMatrix({{a, 17 * b / 29, 0}, {0, 1 / (a * b * c), tsym::pow(12, d)}, {1, 4 * a, 0}});
+    auto rhs = createBoostVector({a * d + 17 * a * b / 116, b * tsym::pow(12, d) + 1 / (b * c * 4), d + a * a});
+    auto x = createBoostVector({0, 0, 0});
+
+    solve(A, rhs, x, x.size(), Algo::Bareiss);
+
+    BOOST_CHECK_EQUAL(d, x(0));
+    BOOST_CHECK_EQUAL(a / 4, x(1));
+    BOOST_CHECK_EQUAL(b, x(2));
+}
+
+BOOST_AUTO_TEST_CASE(bareissSolvePolynomialSystemDim3)
+{
+    auto A = createBoostMatrix({{a, b, 1}, {a * a, c, d}, {1, a + b, c * d}});
+    auto rhs = createBoostVector({a + 2 * b + 3, a * a + 2 * c + 3 * d, 1 + 2 * a + 2 * b + 3 * c * d});
+    auto x = createBoostVector({0, 0, 0});
+
+    solve(A, rhs, x, x.size(), Algo::Bareiss);
+
+    BOOST_CHECK_EQUAL(1, x(0));
+    BOOST_CHECK_EQUAL(2, x(1));
+    BOOST_CHECK_EQUAL(3, x(2));
+}
+
+BOOST_AUTO_TEST_CASE(bareissDetDim4)
+{
+    auto A = createBoostMatrix({{0, 1, a, 3}, {b, 0, 2, 0}, {a, Var(-1, 2), 0, 2}, {0, b, 3, 0}});
+    const Var expected(-6 * a * b - 2 * a * b * b + 21 * b / 2);
+    const Var det = determinant(A, BoostSizeType{4}, Algo::Bareiss);
+
+    BOOST_CHECK_EQUAL(expected, expand(det));
+}
+
+BOOST_AUTO_TEST_CASE(bareissVandermondeDetDim4)
+{
+    const std::array<Var, 4> x = {{a, b, c, d}};
+    Var expected(1);
+    BoostMatrix A(4, 4);
+
+    for (std::size_t i = 0; i < 4; ++i)
+        for (std::size_t j = 0; j < 4; ++j) {
+            A(i, j) = tsym::pow(x[i], static_cast<int>(j));
+
+            if (i < j)
+                expected *= x[j] - x[i];
+        }
+
+    const Var det = determinant(A, BoostSizeType{4}, Algo::Bareiss);
+
+    BOOST_CHECK_EQUAL(expand(expected), expand(det));
+}
+
+BOOST_AUTO_TEST_CASE(bareissDetOfSingularMatrix)
+{
+    auto A = createBoostMatrix({{a, b, 1}, {2 * a, 2 * b, 2}, {c, d, 1}});
+
+    BOOST_CHECK_EQUAL(0, determinant(A, A.size1(), Algo::Bareiss));
+}
+
+BOOST_AUTO_TEST_CASE(bareissInverseDim3)
+{
+    const auto orig = createBoostMatrix({{a, 1, 0}, {b, c, 1}, {0, 2, d}});
+    auto A = orig;
+
+    invert(A, A.size1(), Algo::Bareiss);
+
+    for (std::size_t i = 0; i < 3; ++i)
+        for (std::size_t j = 0; j < 3; ++j) {
+            Var entry(0);
+
+            for (std::size_t k = 0; k < 3; ++k)
+                entry += orig(i, k) * A(k, j);
+
+            BOOST_CHECK_EQUAL(i == j ? 1 : 0, simplify(entry));
+        }
+}
+
+BOOST_AUTO_TEST_CASE(bareissIllegalInverseSingular)
+{
+    auto A = createBoostMatrix({{2 * a, -a * a}, {-2, a}});
+
+    BOOST_CHECK_THROW(invert(A, A.size1(), Algo::Bareiss), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(deferredSimplificationSolvePolynomialSystemDim3)
+{
+    auto A = createBoostMatrix({{a, b, 1}, {a * a, c, d}, {1, a + b, c * d}});
+    auto rhs = createBoostVector({a + 2 * b + 3, a * a + 2 * c + 3 * d, 1 + 2 * a + 2 * b + 3 * c * d});
+    auto x = createBoostVector({0, 0, 0});
+    SolveOptions options(Algo::Gauss);
+
+    options.simplificationThreshold = 1000;
+
+    solve(A, rhs, x, x.size(), options);
+
+    BOOST_CHECK_EQUAL(1, x(0));
+    BOOST_CHECK_EQUAL(2, x(1));
+    BOOST_CHECK_EQUAL(3, x(2));
+}
+
+BOOST_AUTO_TEST_CASE(deferredSimplificationSolveWithSkipField)
+{
+    auto A = createBoostMatrix({{a, 1, 0, 0}, {tsym::pow(a, 3), b, 0, 2}, {0, 0, c, 0}, {a, 0, b, 0}});
+    auto rhs = createBoostVector({1, 2, 3, 4});
+    auto x = createBoostVector({0, 0, 0, 0});
+    const std::vector<bool> skip{false, false, false, false};
+    SolveOptions options;
+
+    options.simplificationThreshold = 0;
+
+    solve(A, rhs, x, skip, x.size(), options);
+
+    BOOST_CHECK_EQUAL((4 * c - 3 * b) / (a * c), x(0));
+    BOOST_CHECK_EQUAL(-3 + 3 * b / c, x(1));
+    BOOST_CHECK_EQUAL(3 / c, x(2));
+}
+
+BOOST_AUTO_TEST_CASE(deferredSimplificationFactorization)
+{
+    auto A = createBoostMatrix({{a, b, c}, {b + 1, a * c, 1}, {c, 2, a + b}});
+    SolveOptions options(Algo::Gauss);
+
+    options.simplificationThreshold = 1000;
+
+    const Factorization deferred(A, A.size1(), options);
+    const Factorization eager(A, A.size1(), Algo::Gauss);
+
+    BOOST_CHECK_EQUAL(eager.determinant(), deferred.determinant());
+    BOOST_TEST((eager.permutation() == deferred.permutation()));
+}
+
+BOOST_AUTO_TEST_CASE(parallelSolvePolynomialSystemDim3)
+{
+    auto A = createBoostMatrix({{a, b, 1}, {a * a, c, d}, {1, a + b, c * d}});
+    auto rhs = createBoostVector({a + 2 * b + 3, a * a + 2 * c + 3 * d, 1 + 2 * a + 2 * b + 3 * c * d});
+
+    for (const Algo algo : {Algo::Gauss, Algo::Bareiss}) {
+        auto x = createBoostVector({0, 0, 0});
+        SolveOptions options(algo);
+
+        options.nThreads = 4;
+
+        solve(A, rhs, x, x.size(), options);
+
+        BOOST_CHECK_EQUAL(1, x(0));
+        BOOST_CHECK_EQUAL(2, x(1));
+        BOOST_CHECK_EQUAL(3, x(2));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(parallelInverseDim4)
+{
+    auto A = createBoostMatrix({{a, 1, 0, b}, {tsym::pow(a, 3), b, 0, 2}, {0, c, c, 0}, {a, 0, b, 1}});
+    SolveOptions options;
+
+    options.nThreads = 4;
+
+    const std::vector<std::vector<Var>> expected = Factorization(A, A.size1()).inverse();
+    const std::vector<std::vector<Var>> result = Factorization(A, A.size1(), options).inverse();
+
+    BOOST_TEST((expected == result));
+}
+
+BOOST_AUTO_TEST_CASE(parallelSolveSingularMatrix)
+{
+    auto A = createBoostMatrix({{a, b, c}, {2 * a, 2 * b, 2 * c}, {1, a, b}});
+    auto rhs = createBoostVector({1, 2, 3});
+    auto x = createBoostVector({0, 0, 0});
+    SolveOptions options;
+
+    options.nThreads = 4;
+
+    BOOST_CHECK_THROW(solve(A, rhs, x, x.size(), options), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_CASE(illegalInverseSingular)
 {
     BoostMatrix A(2, 2);
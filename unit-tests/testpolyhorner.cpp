@@ -0,0 +1,86 @@
+
+#include "basefct.h"
+#include "fixtures.h"
+#include "numeric.h"
+#include "poly.h"
+#include "power.h"
+#include "product.h"
+#include "sum.h"
+#include "trigonometric.h"
+#include "tsymtests.h"
+
+using namespace tsym;
+
+BOOST_FIXTURE_TEST_SUITE(TestPolyHorner, AbcFixture)
+
+BOOST_AUTO_TEST_CASE(numericUnchanged)
+{
+    BOOST_CHECK_EQUAL(two, poly::horner(two));
+}
+
+BOOST_AUTO_TEST_CASE(monomialUnchanged)
+{
+    const BasePtr monomial = Product::create(two, a, Power::create(b, three));
+
+    BOOST_CHECK_EQUAL(monomial, poly::horner(monomial));
+}
+
+BOOST_AUTO_TEST_CASE(nonPolynomialUnchanged)
+{
+    const BasePtr arg = Sum::create(Product::create(a, b), Trigonometric::createSin(a), Power::create(a, two));
+
+    BOOST_CHECK_EQUAL(arg, poly::horner(arg));
+}
+
+BOOST_AUTO_TEST_CASE(univariate)
+/* 2*a^3 + 3*a^2 - a + 4 = 4 + a*(-1 + a*(3 + 2*a)). */
+{
+    const BasePtr arg = Sum::create({Product::create(two, Power::create(a, three)),
+      Product::create(three, Power::create(a, two)), Product::minus(a), four});
+    const BasePtr inner = Product::create(a, Sum::create(three, Product::create(two, a)));
+    const BasePtr expected = Sum::create(four, Product::create(a, Sum::create(Numeric::mOne(), inner)));
+
+    BOOST_CHECK_EQUAL(expected, poly::horner(arg));
+}
+
+BOOST_AUTO_TEST_CASE(univariateWithGapsAndMinDegree)
+/* a^7 + a^3 = a^3*(1 + a^4). */
+{
+    const BasePtr arg = Sum::create(Power::create(a, seven), Power::create(a, three));
+    const BasePtr expected = Product::create(Power::create(a, three), Sum::create(one, Power::create(a, four)));
+
+    BOOST_CHECK_EQUAL(expected, poly::horner(arg));
+}
+
+BOOST_AUTO_TEST_CASE(multivariateSelectsMostFrequentVariable)
+/* a*b*c + a*c + b*c^2 + c = c*(1 + a + a*b + b*c), but c*(1 + a*(1 + b) + b*c) in Horner form. */
+{
+    const BasePtr arg = Sum::create(
+      {Product::create(a, b, c), Product::create(a, c), Product::create(b, Power::create(c, two)), c});
+    const BasePtr result = poly::horner(arg);
+
+    BOOST_TEST(isProduct(*result));
+    BOOST_CHECK_EQUAL(c, result->operands().front());
+    BOOST_CHECK_EQUAL(arg, result->expand());
+}
+
+BOOST_AUTO_TEST_CASE(unexpandedInput)
+{
+    const BasePtr arg = Power::create(Sum::create(a, b, one), four);
+    const BasePtr result = poly::horner(arg);
+
+    BOOST_CHECK_EQUAL(arg->expand(), result->expand());
+    BOOST_TEST(result->complexity() < arg->expand()->complexity());
+}
+
+BOOST_AUTO_TEST_CASE(sameNumericValue)
+{
+    const BasePtr arg = Product::create(Power::create(Sum::create(a, Product::minus(two)), three),
+      Sum::create(Product::create(Numeric::create(1, 3), b), five));
+    const BasePtr result = poly::horner(arg);
+    const BasePtrMap values{{a, Numeric::create(3, 7)}, {b, Numeric::create(-5, 2)}};
+
+    BOOST_CHECK_EQUAL(arg->subst(values), result->subst(values));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
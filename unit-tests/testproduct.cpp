@@ -1,4 +1,5 @@
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include "basefct.h"
@@ -1042,4 +1043,59 @@ BOOST_AUTO_TEST_CASE(dontAlwaysContractZeroSumExp)
     BOOST_TEST(result->operands().size() > 1);
 }
 
+BOOST_AUTO_TEST_CASE(bulkCollectionOfManyFactors)
+/* Many factors are collected in one pass. The exponents of each base are summed up here, the
+ * numeric factors 1/3*5*29/3*sqrt(6)^3*sqrt(2) = 580/sqrt(3) are given explicitly. */
+{
+    const BasePtr bases[] = {a, b, c, Sum::create(a, one), Trigonometric::createSin(d), pi};
+    Int exponents[] = {0, 0, 0, 0, 0, 0};
+    BasePtrList factors;
+
+    for (int i = 0; i < 40; ++i) {
+        const BasePtr& base = bases[i % 6];
+
+        factors.push_back(Power::create(base, Numeric::create(i % 4 - 2, base == pi ? 3 : 1)));
+        exponents[i % 6] += i % 4 - 2;
+
+        if (i % 7 == 0)
+            factors.push_back(i % 2 == 0 ? Numeric::create(i + 1, 3) : sqrtSix);
+    }
+
+    factors.push_back(Product::create(sqrtTwo, e, f));
+
+    const BasePtr result = Product::create(factors);
+    BasePtrList expected{Numeric::create(580), Power::create(three, minusOneHalf), e, f};
+
+    for (std::size_t i = 0; i < 6; ++i)
+        if (exponents[i] != 0)
+            expected.push_back(Power::create(bases[i], Numeric::create(exponents[i])));
+
+    BOOST_CHECK_EQUAL(0, exponents[5]);
+    BOOST_CHECK_EQUAL(9, expected.size());
+    BOOST_CHECK_EQUAL(expected.size(), result->operands().size());
+
+    for (const auto& factor : expected)
+        BOOST_TEST(std::any_of(cbegin(result->operands()), cend(result->operands()),
+          [&factor](const auto& operand) { return operand->isEqual(*factor); }));
+}
+
+BOOST_AUTO_TEST_CASE(bulkCollectionToOne)
+{
+    BasePtrList factors{a, b, c, d};
+
+    for (const auto& symbol : {a, b, c, d})
+        factors.push_back(Power::oneOver(symbol));
+
+    BOOST_CHECK_EQUAL(one, Product::create(factors));
+}
+
+BOOST_AUTO_TEST_CASE(noBulkCollectionOfFractionExponents)
+/* a^(1/2)*a^(1/2) isn't contracted for a symbol a of unknown sign. */
+{
+    const BasePtr sqrtA = Power::sqrt(a);
+    const BasePtr result = Product::create({sqrtA, b, sqrtA, c, d});
+
+    BOOST_CHECK_EQUAL(5, result->operands().size());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
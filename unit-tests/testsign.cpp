@@ -380,4 +380,31 @@ BOOST_AUTO_TEST_CASE(mixedPosAndUnclear)
     checkUnclear(res->subst(*bPos, b));
 }
 
+BOOST_AUTO_TEST_CASE(sumWithBoundedFunction)
+{
+    checkPos(Sum::create(two, Trigonometric::createSin(a)));
+    checkNeg(Sum::create(Product::minus(two), Trigonometric::createCos(a)));
+}
+
+BOOST_AUTO_TEST_CASE(sumWithBoundedFunctionAndPositiveSymbol)
+{
+    const BasePtr atanTerm = Trigonometric::createAtan(Product::create(a, b));
+
+    checkPos(Sum::create({two, aPos, atanTerm, Product::create(bPos, Power::create(c, two))}));
+}
+
+BOOST_AUTO_TEST_CASE(sumWithFunctionOfPositiveSymbol)
+{
+    const BasePtr reciprocal = Power::oneOver(Sum::create(one, aPos));
+
+    checkNeg(Sum::create(reciprocal, Product::minus(two)));
+    checkUnclear(Sum::create(reciprocal, Numeric::create(-1, 2)));
+}
+
+BOOST_AUTO_TEST_CASE(sumWithUnboundedInterval)
+{
+    checkUnclear(Sum::create(two, Trigonometric::createTan(a)));
+    checkUnclear(Sum::create(Numeric::create(-1, 2), Trigonometric::createSin(a)));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
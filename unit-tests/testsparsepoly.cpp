@@ -0,0 +1,144 @@
+
+#include "fixtures.h"
+#include "numeric.h"
+#include "power.h"
+#include "product.h"
+#include "sparsepoly.h"
+#include "sum.h"
+#include "trigonometric.h"
+#include "tsymtests.h"
+
+using namespace tsym;
+
+struct SparsePolyFixture : public AbcFixture {
+    const BasePtrList variables{a, b, c};
+    /* 2*a^2*b + a*c - 1/3: */
+    const BasePtr u = Sum::create(
+      Product::create(two, Power::create(a, two), b), Product::create(a, c), Numeric::create(-1, 3));
+    /* a + b*c: */
+    const BasePtr v = Sum::create(a, Product::create(b, c));
+
+    SparsePoly sparse(const BasePtr& arg) const
+    {
+        const auto result = SparsePoly::fromBase(*arg, variables);
+
+        BOOST_REQUIRE(result);
+
+        return *result;
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestSparsePoly, SparsePolyFixture)
+
+BOOST_AUTO_TEST_CASE(zero)
+{
+    const SparsePoly zero = sparse(Numeric::zero());
+
+    BOOST_TEST(zero.isZero());
+    BOOST_TEST(zero.isConstant());
+    BOOST_CHECK_EQUAL(0, zero.degree(0));
+    BOOST_CHECK_EQUAL(Numeric::zero(), zero.toBase(variables));
+}
+
+BOOST_AUTO_TEST_CASE(termsAreSortedAndCollected)
+{
+    const SparsePoly poly = sparse(Sum::create(u, Product::minus(a, c), Power::create(b, three)));
+    const SparsePoly::Exponents first{2, 1, 0};
+    const SparsePoly::Exponents second{0, 3, 0};
+
+    BOOST_REQUIRE_EQUAL(3, poly.terms().size());
+    BOOST_TEST(first == poly.terms().front().exponents, per_element());
+    BOOST_CHECK_EQUAL(2, poly.terms().front().coeff);
+    BOOST_TEST(second == poly.terms()[1].exponents, per_element());
+    BOOST_CHECK_EQUAL(Number(-1, 3), poly.terms().back().coeff);
+}
+
+BOOST_AUTO_TEST_CASE(conversionRoundTrip)
+{
+    BOOST_CHECK_EQUAL(u, sparse(u).toBase(variables));
+}
+
+BOOST_AUTO_TEST_CASE(unexpandedInput)
+{
+    const BasePtr arg = Product::create(Power::create(v, three), u);
+
+    BOOST_CHECK_EQUAL(arg->expand(), sparse(arg).toBase(variables));
+}
+
+BOOST_AUTO_TEST_CASE(invalidInput)
+{
+    BOOST_TEST(!SparsePoly::fromBase(*Sum::create(a, d), variables));
+    BOOST_TEST(!SparsePoly::fromBase(*Power::sqrt(a), variables));
+    BOOST_TEST(!SparsePoly::fromBase(*Product::create(a, Trigonometric::createSin(b)), variables));
+    BOOST_TEST(!SparsePoly::fromBase(*Numeric::create(0.123456789), variables));
+}
+
+BOOST_AUTO_TEST_CASE(arithmetic)
+{
+    const SparsePoly uSparse = sparse(u);
+    const SparsePoly vSparse = sparse(v);
+
+    BOOST_CHECK_EQUAL(Sum::create(u, v), (uSparse + vSparse).toBase(variables));
+    BOOST_CHECK_EQUAL(Sum::create(u, Product::minus(v)), (uSparse - vSparse).toBase(variables));
+    BOOST_CHECK_EQUAL(Product::create(u, v)->expand(), (uSparse * vSparse).toBase(variables));
+    BOOST_TEST((uSparse - uSparse).isZero());
+}
+
+BOOST_AUTO_TEST_CASE(degreeAndCoefficients)
+{
+    const SparsePoly poly = sparse(u);
+
+    BOOST_CHECK_EQUAL(2, poly.degree(0));
+    BOOST_CHECK_EQUAL(0, poly.minDegree(0));
+    BOOST_CHECK_EQUAL(1, poly.minDegree(2) + poly.degree(2));
+    BOOST_CHECK_EQUAL(Product::create(two, b), poly.leadingCoeff(0).toBase(variables));
+    BOOST_CHECK_EQUAL(c, poly.coeff(0, 1).toBase(variables));
+}
+
+BOOST_AUTO_TEST_CASE(integerContent)
+{
+    const SparsePoly poly = sparse(Sum::create(Product::create(six, a, b), Product::create(Numeric::create(-4), c)));
+
+    BOOST_TEST(poly.hasIntegerCoefficients());
+    BOOST_TEST(!sparse(u).hasIntegerCoefficients());
+    BOOST_CHECK_EQUAL(2, poly.integerContent());
+    BOOST_CHECK_EQUAL(1, sparse(u).integerContent());
+    BOOST_CHECK_EQUAL(0, sparse(Numeric::zero()).integerContent());
+}
+
+BOOST_AUTO_TEST_CASE(exactDivision)
+{
+    const SparsePoly product = sparse(Product::create(u, v));
+    const auto [quotient, remainder] = divide(product, sparse(v), 0);
+
+    BOOST_CHECK_EQUAL(u, quotient.toBase(variables));
+    BOOST_TEST(remainder.isZero());
+    BOOST_TEST(divides(sparse(v), product, 0));
+    BOOST_TEST(!divides(product, sparse(v), 0));
+}
+
+BOOST_AUTO_TEST_CASE(divisionMatchesTreeBasedDivision)
+{
+    const BasePtr dividend = Sum::create(Product::create(u, v), Power::create(c, three), b);
+    const auto [quotient, remainder] = divide(sparse(dividend), sparse(v), 0);
+    const BasePtr expected = Sum::create(Product::create(quotient.toBase(variables), v), remainder.toBase(variables));
+
+    BOOST_CHECK_EQUAL(dividend->expand(), expected->expand());
+    BOOST_TEST(!remainder.isZero());
+}
+
+BOOST_AUTO_TEST_CASE(pseudoDivision)
+/* The pseudo-remainder r satisfies lc(v)^(deg(u) - deg(v) + 1)*u = q*v + r. */
+{
+    const SparsePoly uSparse = sparse(u);
+    const SparsePoly vSparse = sparse(Sum::create(Product::create(three, b, a), c));
+    const auto [quotient, remainder] = pseudoDivide(uSparse, vSparse, 0);
+    const SparsePoly factor = vSparse.leadingCoeff(0).toThe(2);
+
+    BOOST_CHECK_EQUAL(1, quotient.degree(0));
+    BOOST_CHECK_EQUAL(0, remainder.degree(0));
+    BOOST_TEST((factor * uSparse == quotient * vSparse + remainder));
+    BOOST_TEST((remainder == pseudoRemainder(uSparse, vSparse, 0)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
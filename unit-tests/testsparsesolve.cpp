@@ -0,0 +1,130 @@
+
+#include <vector>
+#include "boostmatrixvector.h"
+#include "functions.h"
+#include "solve.h"
+#include "sparse.h"
+#include "tsymtests.h"
+
+using namespace tsym;
+
+struct SparseSolveFixture {
+    const Var a{"a"};
+    const Var b{"b"};
+    const Var c{"c"};
+
+    std::vector<Var> multiply(const CsrMatrix& A, const std::vector<Var>& x) const
+    {
+        std::vector<Var> result(A.pattern.nRows, 0);
+
+        for (std::size_t i = 0; i < A.pattern.nRows; ++i)
+            for (std::size_t k = A.pattern.rowPointers[i]; k < A.pattern.rowPointers[i + 1]; ++k)
+                result[i] += A.values[k] * x[A.pattern.columnIndices[k]];
+
+        return result;
+    }
+
+    void checkSolution(const CsrMatrix& A, const std::vector<Var>& expected) const
+    {
+        const std::vector<Var> x = solve(A, multiply(A, expected));
+
+        BOOST_REQUIRE_EQUAL(expected.size(), x.size());
+
+        for (std::size_t i = 0; i < x.size(); ++i)
+            BOOST_CHECK_EQUAL(expected[i], simplify(x[i]));
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestSparseSolve, SparseSolveFixture)
+
+BOOST_AUTO_TEST_CASE(assembleFromTriplets)
+{
+    const std::vector<Triplet> triplets{{1, 2, a}, {0, 1, 2}, {1, 0, b}, {0, 1, c}, {2, 2, a}, {2, 2, -a}};
+    const std::vector<std::size_t> expectedRowPointers{0, 1, 3, 3};
+    const std::vector<std::size_t> expectedColumns{1, 0, 2};
+    const std::vector<Var> expectedValues{2 + c, b, a};
+    const CsrMatrix A = fromTriplets(3, 3, triplets);
+
+    BOOST_CHECK_EQUAL(3, A.pattern.nRows);
+    BOOST_CHECK_EQUAL(3, A.pattern.nColumns);
+    BOOST_TEST(expectedRowPointers == A.pattern.rowPointers, per_element());
+    BOOST_TEST(expectedColumns == A.pattern.columnIndices, per_element());
+    BOOST_TEST(expectedValues == A.values, per_element());
+}
+
+BOOST_AUTO_TEST_CASE(zeroDimension)
+{
+    BOOST_TEST(solve(CsrMatrix{}, {}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(zeroDiagonalRequiresPivoting)
+{
+    const CsrMatrix A = fromTriplets(3, 3, {{0, 1, a}, {0, 2, 1}, {1, 0, b}, {1, 2, 2}, {2, 0, 1}, {2, 1, c}});
+
+    checkSolution(A, {1, a, b * c});
+}
+
+BOOST_AUTO_TEST_CASE(tridiagonalSystemWithSymbolicRhs)
+{
+    const std::size_t dim = 100;
+    std::vector<Triplet> triplets;
+    std::vector<Var> expected;
+
+    for (std::size_t i = 0; i < dim; ++i) {
+        triplets.push_back({i, i, 2});
+        expected.push_back(a + static_cast<int>(i) * b);
+
+        if (i > 0)
+            triplets.push_back({i, i - 1, -1});
+        if (i + 1 < dim)
+            triplets.push_back({i, i + 1, -1});
+    }
+
+    checkSolution(fromTriplets(dim, dim, triplets), expected);
+}
+
+BOOST_AUTO_TEST_CASE(arrowMatrix)
+/* With the dense row and column first, naive elimination fills the whole matrix. The Markowitz
+ * ordering eliminates the diagonal part first without any fill-in. */
+{
+    const std::size_t dim = 100;
+    std::vector<Triplet> triplets{{0, 0, a}};
+    std::vector<Var> expected{1};
+
+    for (std::size_t i = 1; i < dim; ++i) {
+        triplets.push_back({0, i, 1});
+        triplets.push_back({i, 0, b});
+        triplets.push_back({i, i, c});
+        expected.push_back(static_cast<int>(i));
+    }
+
+    checkSolution(fromTriplets(dim, dim, triplets), expected);
+}
+
+BOOST_AUTO_TEST_CASE(agreesWithDenseSolve)
+{
+    const auto dense = createBoostMatrix({{a, 0, 2, 0}, {0, 0, b, 1}, {1, c, 0, 0}, {0, 3, 0, a * b}});
+    const std::vector<Var> rhs{1, a, b, c};
+    std::vector<Triplet> triplets;
+    std::vector<Var> expected(4);
+
+    for (std::size_t i = 0; i < 4; ++i)
+        for (std::size_t j = 0; j < 4; ++j)
+            triplets.push_back({i, j, dense(i, j)});
+
+    solve(dense, rhs, expected, std::size_t{4});
+
+    const std::vector<Var> x = solve(fromTriplets(4, 4, triplets), rhs);
+
+    for (std::size_t i = 0; i < 4; ++i)
+        BOOST_CHECK_EQUAL(0, simplify(x[i] - expected[i]));
+}
+
+BOOST_AUTO_TEST_CASE(singularMatrix)
+{
+    const CsrMatrix A = fromTriplets(3, 3, {{0, 0, a}, {0, 1, b}, {1, 0, 2 * a}, {1, 1, 2 * b}, {2, 2, c}});
+
+    BOOST_CHECK_THROW(solve(A, {1, 2, 3}), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -295,4 +295,57 @@ BOOST_AUTO_TEST_CASE(mixedTerm)
     BOOST_CHECK_EQUAL(expected, res);
 }
 
+BOOST_AUTO_TEST_CASE(mapWithSimultaneousSwap)
+/* a + 2*b = b + 2*a for a -> b and b -> a. */
+{
+    const BasePtr orig = Sum::create(a, Product::create(two, b));
+    const BasePtr expected = Sum::create(b, Product::create(two, a));
+    const BasePtr res = orig->subst(BasePtrMap{{a, b}, {b, a}});
+
+    BOOST_CHECK_EQUAL(expected, res);
+}
+
+BOOST_AUTO_TEST_CASE(mapWithoutMatchReturnsIdenticalObject)
+{
+    const BasePtr orig = Product::create(a, Power::create(Sum::create(b, c), d), Trigonometric::createSin(a));
+    const BasePtr res = orig->subst(BasePtrMap{{e, one}, {f, two}});
+
+    BOOST_CHECK_EQUAL(orig.get(), res.get());
+}
+
+BOOST_AUTO_TEST_CASE(mapEqualsSequentialSubstitution)
+{
+    const BasePtr orig = Sum::create({Product::create(a, b, c), Power::create(Sum::create(a, d), two),
+      Logarithm::create(Product::create(b, d)), Trigonometric::createAtan2(c, a)});
+    const BasePtr sequential = orig->subst(*a, two)->subst(*b, Sum::create(e, f))->subst(*d, seven);
+    const BasePtr res = orig->subst(BasePtrMap{{a, two}, {b, Sum::create(e, f)}, {d, seven}});
+
+    BOOST_CHECK_EQUAL(sequential, res);
+}
+
+BOOST_AUTO_TEST_CASE(mapWithCompositeKey)
+{
+    const BasePtr sum = Sum::create(a, b);
+    const BasePtr orig = Product::create(c, Power::create(sum, three), Trigonometric::createCos(sum));
+    const BasePtr expected = Product::create(c, Power::create(d, three), Trigonometric::createCos(d));
+    const BasePtr res = orig->subst(BasePtrMap{{sum, d}});
+
+    BOOST_CHECK_EQUAL(expected, res);
+}
+
+BOOST_AUTO_TEST_CASE(mapSimplifiesResult)
+{
+    const BasePtr orig = Sum::create(Product::create(a, b), Product::minus(c, d));
+    const BasePtr res = orig->subst(BasePtrMap{{a, c}, {b, d}});
+
+    BOOST_CHECK_EQUAL(zero, res);
+}
+
+BOOST_AUTO_TEST_CASE(mapWithUndefinedKey)
+{
+    const BasePtr res = undefined->subst(BasePtrMap{{a, b}, {undefined, c}});
+
+    BOOST_CHECK_EQUAL(c, res);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -502,4 +502,45 @@ BOOST_AUTO_TEST_CASE(nonContractableSinCosSquareNonEqualPrefactor)
     BOOST_CHECK_EQUAL(s1, result->operands().back());
 }
 
+BOOST_AUTO_TEST_CASE(bulkCollectionEqualsPairwiseMerge)
+/* Many summands are collected in one pass, which must give the same result as adding one summand
+ * after another. */
+{
+    BasePtrList summands;
+    BasePtr expected = zero;
+
+    for (int i = 0; i < 40; ++i) {
+        const BasePtr coeff = i % 3 == 0 ? Numeric::create(i - 20, 7) : Power::sqrt(Numeric::create(i % 5 + 2));
+        const BasePtr power = Power::create(i % 2 == 0 ? a : b, Numeric::create(i % 6));
+
+        summands.push_back(Product::create(coeff, power, i % 4 == 0 ? c : pi));
+        summands.push_back(Numeric::create(i, 3));
+    }
+
+    summands.push_back(Sum::create(a, b, Product::minus(c)));
+
+    for (const auto& summand : summands)
+        expected = Sum::create(expected, summand);
+
+    BOOST_CHECK_EQUAL(expected, Sum::create(summands));
+}
+
+BOOST_AUTO_TEST_CASE(bulkCollectionToZero)
+{
+    BasePtrList summands{a, b, c, d};
+
+    for (const auto& symbol : {a, b, c, d})
+        summands.push_back(Product::minus(symbol));
+
+    BOOST_CHECK_EQUAL(zero, Sum::create(summands));
+}
+
+BOOST_AUTO_TEST_CASE(contractableSinCosSquareInManySummands)
+{
+    const BasePtr result = Sum::create({a, Power::create(sinA, two), b, c, Power::create(cosA, two), d});
+
+    BOOST_TEST(!result->has(*sinA));
+    BOOST_TEST(!result->has(*cosA));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,119 @@
+
+#include "fixtures.h"
+#include "numeric.h"
+#include "power.h"
+#include "product.h"
+#include "sum.h"
+#include "truncatedexpansion.h"
+#include "tsymtests.h"
+
+using namespace tsym;
+
+struct TruncatedExpansionFixture : public AbcFixture {
+    const BasePtr onePlusA = Sum::create(one, a);
+    const BasePtr onePlusB = Sum::create(one, b);
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestTruncatedExpansion, TruncatedExpansionFixture)
+
+BOOST_AUTO_TEST_CASE(totalDegree)
+/* (1 + a + b)^5 up to total degree 2 in a and b. */
+{
+    const BasePtr arg = Power::create(Sum::create(one, a, b), five);
+    const BasePtr result = expandTruncated(arg, {{a, b}, {}, 2});
+    const BasePtr full = arg->expand();
+    BasePtrList expected;
+
+    for (const auto& term : full->operands())
+        if (term->degree(*a) + term->degree(*b) <= 2)
+            expected.push_back(term);
+
+    BOOST_CHECK_EQUAL(Sum::create(expected), result);
+}
+
+BOOST_AUTO_TEST_CASE(degreePerVariable)
+/* (1 + a)^3*(1 + b)^3 up to a^1 and b^2 = (1 + 3*a)*(1 + 3*b + 3*b^2). */
+{
+    const BasePtr arg = Product::create(Power::create(onePlusA, three), Power::create(onePlusB, three));
+    const BasePtr expected = Product::create(Sum::create(one, Product::create(three, a)),
+      Sum::create(one, Product::create(three, b), Product::create(three, b, b)))->expand();
+
+    BOOST_CHECK_EQUAL(expected, expandTruncated(arg, {{a, b}, {1, 2}, std::nullopt}));
+}
+
+BOOST_AUTO_TEST_CASE(onlyTotalDegreeOfBothBounds)
+/* (1 + a)^3*(1 + b)^3 up to a^1 and total degree 1 = 1 + 3*a + 3*b. */
+{
+    const BasePtr arg = Product::create(Power::create(onePlusA, three), Power::create(onePlusB, three));
+    const BasePtr expected = Sum::create(one, Product::create(three, a), Product::create(three, b));
+
+    BOOST_CHECK_EQUAL(expected, expandTruncated(arg, {{a, b}, {1, std::nullopt}, 1}));
+}
+
+BOOST_AUTO_TEST_CASE(largeExponent)
+/* (1 + a + a^2)^1000 = 1 + 1000*a + 500500*a^2 + O(a^3). */
+{
+    const BasePtr arg = Power::create(Sum::create(one, a, Power::create(a, two)), Numeric::create(1000));
+    const BasePtr expected = Sum::create(
+      one, Product::create(Numeric::create(1000), a), Product::create(Numeric::create(500500), a, a));
+
+    BOOST_CHECK_EQUAL(expected, expandTruncated(arg, {{a}, {}, 2}));
+}
+
+BOOST_AUTO_TEST_CASE(otherSymbolsUnbounded)
+/* (a + c)^2 up to a^1 = c^2 + 2*a*c. */
+{
+    const BasePtr arg = Power::create(Sum::create(a, c), two);
+    const BasePtr expected = Sum::create(Power::create(c, two), Product::create(two, a, c));
+
+    BOOST_CHECK_EQUAL(expected, expandTruncated(arg, {{a}, {1}, std::nullopt}));
+}
+
+BOOST_AUTO_TEST_CASE(fractionalExponents)
+/* (1 + sqrt(a))^4 up to a^1 = 1 + 4*sqrt(a) + 6*sqrt(a)*sqrt(a). */
+{
+    const BasePtr sqrtA = Power::sqrt(a);
+    const BasePtr arg = Power::create(Sum::create(one, sqrtA), four);
+    const BasePtr expected = Sum::create(one, Product::create(four, sqrtA), Product::create(six, sqrtA, sqrtA));
+
+    BOOST_CHECK_EQUAL(expected, expandTruncated(arg, {{a}, {}, 1}));
+}
+
+BOOST_AUTO_TEST_CASE(denominatorNotTruncated)
+/* (a + b)^2/(1 + a) up to a^1 = b^2/(1 + a) + 2*a*b/(1 + a). */
+{
+    const BasePtr arg = Product::create(Power::create(Sum::create(a, b), two), Power::oneOver(onePlusA));
+    const BasePtr expected =
+      Product::create(Sum::create(Power::create(b, two), Product::create(two, a, b)), Power::oneOver(onePlusA))
+        ->expand();
+
+    BOOST_CHECK_EQUAL(expected, expandTruncated(arg, {{a}, {}, 1}));
+}
+
+BOOST_AUTO_TEST_CASE(boundedVariableInDenominator)
+/* (1 + a)^3/a up to a^1 = 1/a + 3 + 3*a, where 3*a^2 must not be dropped before the division. */
+{
+    const BasePtr arg = Product::create(Power::create(onePlusA, three), Power::oneOver(a));
+    const BasePtr expected = Sum::create(Power::oneOver(a), three, Product::create(three, a));
+
+    BOOST_CHECK_EQUAL(expected, expandTruncated(arg, {{a}, {}, 1}));
+}
+
+BOOST_AUTO_TEST_CASE(powerWithBoundedVariableInDenominator)
+/* (a + 1/a)^3 up to a^1 = 3*a + 3/a + 1/a^3. */
+{
+    const BasePtr arg = Power::create(Sum::create(a, Power::oneOver(a)), three);
+    const BasePtr expected = Sum::create(
+      Product::create(three, a), Product::create(three, Power::oneOver(a)), Power::create(a, Numeric::create(-3)));
+
+    BOOST_CHECK_EQUAL(expected, expandTruncated(arg, {{a}, {}, 1}));
+}
+
+BOOST_AUTO_TEST_CASE(everythingTruncated)
+{
+    const BasePtr arg = Power::create(Sum::create(a, b), Numeric::create(10));
+
+    BOOST_CHECK_EQUAL(zero, expandTruncated(arg, {{a, b}, {}, 9}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,196 @@
+
+#include <random>
+#include "fixtures.h"
+#include "modpoly.h"
+#include "numeric.h"
+#include "power.h"
+#include "product.h"
+#include "sum.h"
+#include "tsymtests.h"
+#include "unipoly.h"
+
+using namespace tsym;
+
+struct UniPolyFixture : public AbcFixture {
+    std::minstd_rand generator{42};
+    const std::uint64_t p = 2147483629;
+
+    UniPoly random(std::size_t length, int maxCoeff, int denominator = 1)
+    {
+        std::uniform_int_distribution<int> distribution(-maxCoeff, maxCoeff);
+        std::vector<Number> coeffs;
+
+        for (std::size_t i = 0; i < length; ++i)
+            coeffs.emplace_back(Int(distribution(generator)), Int(denominator));
+
+        coeffs.back() = 1;
+
+        return UniPoly(std::move(coeffs));
+    }
+
+    modp::DenseCoeffs randomModP(std::size_t length)
+    {
+        std::uniform_int_distribution<std::uint64_t> distribution(0, p - 1);
+        modp::DenseCoeffs result;
+
+        for (std::size_t i = 0; i < length; ++i)
+            result.push_back(distribution(generator));
+
+        result.back() = 1;
+
+        return result;
+    }
+
+    UniPoly schoolbook(const UniPoly& u, const UniPoly& v) const
+    {
+        std::vector<Number> result(u.coeffs().size() + v.coeffs().size() - 1, 0);
+
+        for (std::size_t i = 0; i < u.coeffs().size(); ++i)
+            for (std::size_t j = 0; j < v.coeffs().size(); ++j)
+                result[i + j] += u.coeffs()[i] * v.coeffs()[j];
+
+        return UniPoly(std::move(result));
+    }
+
+    modp::DenseCoeffs euclid(modp::DenseCoeffs u, modp::DenseCoeffs v) const
+    {
+        while (!v.empty()) {
+            modp::DenseCoeffs remainder = modp::divide(u, v, p).second;
+
+            u = std::move(v);
+            v = std::move(remainder);
+        }
+
+        const std::uint64_t factor = modp::inverse(u.back(), p);
+
+        for (auto& c : u)
+            c = c * factor % p;
+
+        return u;
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestUniPoly, UniPolyFixture)
+
+BOOST_AUTO_TEST_CASE(trailingZerosRemoved)
+{
+    const UniPoly u({1, 2, 0, 0});
+
+    BOOST_CHECK_EQUAL(2, u.coeffs().size());
+    BOOST_CHECK_EQUAL(1, u.degree());
+    BOOST_CHECK_EQUAL(2, u.leadingCoeff());
+    BOOST_TEST(UniPoly({0, 0}).isZero());
+}
+
+BOOST_AUTO_TEST_CASE(conversion)
+/* 2/3*a^3 - a + 5: */
+{
+    const BasePtr arg = Sum::create(Product::create(Numeric::create(2, 3), Power::create(a, three)),
+      Product::minus(a), five);
+    const auto u = UniPoly::fromBase(*arg, a);
+
+    BOOST_REQUIRE(u);
+    BOOST_TEST((*u == UniPoly({5, -1, 0, Number(2, 3)})));
+    BOOST_CHECK_EQUAL(arg, u->toBase(a));
+}
+
+BOOST_AUTO_TEST_CASE(conversionFails)
+{
+    BOOST_TEST(!UniPoly::fromBase(*Sum::create(a, b), a));
+    BOOST_TEST(!UniPoly::fromBase(*Sum::create(Power::create(a, Numeric::create(1000)), one), a));
+}
+
+BOOST_AUTO_TEST_CASE(karatsubaProduct)
+{
+    const UniPoly u = random(150, 1000, 7);
+    const UniPoly v = random(40, 1000);
+
+    BOOST_TEST((u * v == schoolbook(u, v)));
+    BOOST_TEST((v * u == schoolbook(u, v)));
+}
+
+BOOST_AUTO_TEST_CASE(nttProduct)
+{
+    const UniPoly u = random(110, 1000000);
+    const UniPoly v = random(100, 1000000, 3);
+
+    BOOST_TEST((u * v == schoolbook(u, v)));
+}
+
+BOOST_AUTO_TEST_CASE(productWithTooLargeCoefficientsForNtt)
+{
+    const Number large(pow(Int(10), 30));
+    const UniPoly u = random(100, 100) * UniPoly({large});
+    const UniPoly v = random(100, 100) * UniPoly({large});
+
+    BOOST_TEST((u * v == schoolbook(u, v)));
+}
+
+BOOST_AUTO_TEST_CASE(classicalDivision)
+{
+    const UniPoly u({1, 2, 3, 4});
+    const UniPoly v({1, 2});
+    const auto [quotient, remainder] = divide(u, v);
+
+    BOOST_TEST((quotient == UniPoly({Number(3, 4), Number(1, 2), 2})));
+    BOOST_TEST((remainder == UniPoly({Number(1, 4)})));
+}
+
+BOOST_AUTO_TEST_CASE(newtonDivision)
+{
+    const UniPoly q = random(200, 100, 5);
+    const UniPoly v = random(100, 100);
+    const UniPoly r = random(99, 100);
+    const auto [quotient, remainder] = divide(q * v + r, v);
+
+    BOOST_TEST((quotient == q));
+    BOOST_TEST((remainder == r));
+}
+
+BOOST_AUTO_TEST_CASE(halfGcdModP)
+{
+    const modp::DenseCoeffs g = randomModP(80);
+    const modp::DenseCoeffs u = modp::multiply(g, randomModP(150), p);
+    const modp::DenseCoeffs v = modp::multiply(g, randomModP(120), p);
+    const modp::DenseCoeffs result = modp::gcd(u, v, p);
+
+    BOOST_TEST((result == euclid(u, v)));
+    BOOST_TEST(modp::divide(result, g, p).second.empty());
+}
+
+BOOST_AUTO_TEST_CASE(gcdOverIntegers)
+/* Gcd((a + 1)^3*(2*a - 3), 6*(a + 1)^2*(a^2 + 5)) = (a + 1)^2: */
+{
+    const UniPoly u = UniPoly({1, 1}).toThe(3) * UniPoly({-3, 2});
+    const UniPoly v = UniPoly({6}) * UniPoly({1, 1}).toThe(2) * UniPoly({5, 0, 1});
+    const auto result = gcd(u, v);
+
+    BOOST_REQUIRE(result);
+    BOOST_TEST((*result == UniPoly({1, 2, 1})));
+}
+
+BOOST_AUTO_TEST_CASE(gcdOfLargeDegree)
+{
+    const UniPoly g = random(90, 50);
+    const auto result = gcd(g * random(120, 50), g * UniPoly({2}) * random(100, 50));
+
+    BOOST_REQUIRE(result);
+    BOOST_TEST((*result == g));
+}
+
+BOOST_AUTO_TEST_CASE(gcdOfNonIntegerCoefficients)
+{
+    BOOST_TEST(!gcd(UniPoly({Number(1, 2), 1}), UniPoly({1, 1})));
+}
+
+BOOST_AUTO_TEST_CASE(powerExpansion)
+/* The coefficient of a^20 in (a + 1)^40 is binomial(40, 20): */
+{
+    const BasePtr result = Power::create(Sum::create(a, one), Numeric::create(40))->expand();
+
+    BOOST_CHECK_EQUAL(Numeric::create(Int("137846528820")), result->coeff(*a, 20));
+    BOOST_CHECK_EQUAL(one, result->coeff(*a, 40));
+    BOOST_CHECK_EQUAL(one, result->coeff(*a, 0));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
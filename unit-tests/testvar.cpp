@@ -268,6 +268,57 @@ BOOST_AUTO_TEST_CASE(substituteInSimpleSum)
     BOOST_CHECK_EQUAL(expected, subst(orig, b, Var(1, 3)));
 }
 
+BOOST_AUTO_TEST_CASE(substituteMultipleSymbols)
+{
+    const Var orig = a / b + tsym::pow(c, 2) * tsym::sin(d);
+    const std::unordered_map<Var, Var> replacements{{b, Var(1, 3)}, {c, a + 1}, {d, 0}};
+    const Var expected = 3 * a;
+
+    BOOST_CHECK_EQUAL(expected, subst(orig, replacements));
+}
+
+BOOST_AUTO_TEST_CASE(evaluateWithBindings)
+{
+    const Var expr = a * tsym::pow(b, 2) + c;
+    const std::unordered_map<Var, Var> bindings{{a, 3}, {b, Var(1, 2)}, {c, 1}};
+    const auto result = evaluate(expr, bindings);
+
+    BOOST_CHECK_EQUAL(Var(7, 4), result.value());
+    BOOST_CHECK_EQUAL(Var::Type::FRACTION, result->type());
+}
+
+BOOST_AUTO_TEST_CASE(evaluateWithMissingBinding)
+{
+    BOOST_TEST(!evaluate(a * b, {{a, 2}}));
+}
+
+BOOST_AUTO_TEST_CASE(hornerScheme)
+{
+    const Var poly = tsym::pow(a, 3) + 2 * tsym::pow(a, 2) * b + a;
+    const Var expected = a * (1 + a * (2 * b + a));
+
+    BOOST_CHECK_EQUAL(expected, horner(poly));
+    BOOST_CHECK_EQUAL(poly, expand(horner(poly)));
+}
+
+BOOST_AUTO_TEST_CASE(probabilisticZeroTest)
+{
+    const Var zero = (a + b) / (a * a - b * b) - 1 / (a - b);
+
+    BOOST_TEST(zero != 0);
+    BOOST_TEST(isZeroProbably(zero));
+    BOOST_TEST(!isZeroProbably(zero + 1 / (a * b)));
+    BOOST_TEST(!isZeroProbably(tsym::sin(a), 1e-3));
+}
+
+BOOST_AUTO_TEST_CASE(truncatedExpansion)
+{
+    const Var eps("eps");
+    const Var result = expand(tsym::pow(1 + eps * a, 4) * tsym::pow(1 - eps, 3), {{eps}, 1, {}});
+
+    BOOST_CHECK_EQUAL(1 + 4 * a * eps - 3 * eps, result);
+}
+
 BOOST_AUTO_TEST_CASE(defaultAssignment)
 {
     Var var;
@@ -0,0 +1,89 @@
+
+#include "basefct.h"
+#include "fixtures.h"
+#include "numeric.h"
+#include "power.h"
+#include "product.h"
+#include "sum.h"
+#include "trigonometric.h"
+#include "tsymtests.h"
+#include "undefined.h"
+#include "zerotest.h"
+
+using namespace tsym;
+
+struct ZeroTestFixture : public AbcFixture {
+    const double errorBound = 1e-12;
+
+    std::optional<bool> isZero(const BasePtr& arg) const
+    {
+        return isZeroModular(*arg, errorBound);
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestZeroTest, ZeroTestFixture)
+
+BOOST_AUTO_TEST_CASE(numerics)
+{
+    BOOST_CHECK(isZero(zero) == true);
+    BOOST_CHECK(isZero(Numeric::create(2, 3)) == false);
+}
+
+BOOST_AUTO_TEST_CASE(nonExpandedPolynomial)
+/* (a + b)^2 - a^2 - 2*a*b - b^2: */
+{
+    const BasePtr arg = Sum::create({Power::create(Sum::create(a, b), two), Product::minus(Power::create(a, two)),
+      Product::minus(two, a, b), Product::minus(Power::create(b, two))});
+
+    BOOST_TEST(!tsym::isZero(*arg));
+    BOOST_CHECK(isZero(arg) == true);
+}
+
+BOOST_AUTO_TEST_CASE(nonZeroPolynomial)
+{
+    const BasePtr arg = Sum::create(Power::create(Sum::create(a, b), two), Product::minus(Power::create(a, two)));
+
+    BOOST_CHECK(isZero(arg) == false);
+}
+
+BOOST_AUTO_TEST_CASE(rationalFunction)
+/* 1/(a - 1) - 1/(a + 1) - 2/(a^2 - 1): */
+{
+    const BasePtr aMinusOne = Sum::create(a, Numeric::mOne());
+    const BasePtr arg = Sum::create(Power::oneOver(aMinusOne), Product::minus(Power::oneOver(Sum::create(a, one))),
+      Product::minus(two, Power::oneOver(Sum::create(Power::create(a, two), Numeric::mOne()))));
+
+    BOOST_CHECK(isZero(arg) == true);
+    BOOST_CHECK(isZero(Sum::create(arg, Power::oneOver(aMinusOne))) == false);
+}
+
+BOOST_AUTO_TEST_CASE(coefficientDivisibleByPrime)
+/* Random primes are used, so no single prime can make a non-zero expression vanish: */
+{
+    const BasePtr arg = Product::create(Numeric::create(2147483647), Numeric::create(2147483629), a);
+
+    BOOST_CHECK(isZero(arg) == false);
+}
+
+BOOST_AUTO_TEST_CASE(largeExponent)
+/* a^100000*(a + 1) - a^100001 - a^100000: */
+{
+    const BasePtr aToTheLarge = Power::create(a, Numeric::create(100000));
+    const BasePtr arg = Sum::create(Product::create(aToTheLarge, Sum::create(a, one)),
+      Product::minus(Power::create(a, Numeric::create(100001))), Product::minus(aToTheLarge));
+    const BasePtr nonZero = Sum::create(aToTheLarge, Power::create(b, three));
+
+    BOOST_CHECK(isZero(arg) == true);
+    BOOST_CHECK(isZero(nonZero) == false);
+}
+
+BOOST_AUTO_TEST_CASE(notApplicable)
+{
+    BOOST_CHECK(!isZero(Trigonometric::createSin(a)));
+    BOOST_CHECK(!isZero(Sum::create(a, pi)));
+    BOOST_CHECK(!isZero(Power::sqrt(a)));
+    BOOST_CHECK(!isZero(Numeric::create(1.23456789)));
+    BOOST_CHECK(!isZero(undefined));
+}
+
+BOOST_AUTO_TEST_SUITE_END()